@@ -6,18 +6,246 @@
 
 #include <stdint.h>
 #include <pmsis/kernel/memory.h>
+#include <pmsis/kernel/builtins.h>
 #include <pmsis/kernel/irq.h>
+#include <pmsis/kernel/event.h>
 #include <kernel/riscv.h>
 #include <kernel/hal.h>
+#include PI_CHIP_INC(CONFIG_CHIP_FAMILY_NAME, kernel/properties.h)
 
 PI_MEMORY_TINY uint_t __pi_irq_handlers[32];
 PI_MEMORY_TINY uint_t __pi_irq_handlers_arg[32];
 
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+// Lines whose vector jumps directly to a fast handler. They return with mret and can only be
+// executed by trapping.
+static uint32_t __pi_irq_fast_lines;
+#endif
+
+#if defined(CHIP_HAS_ALIAS) && !defined(CONFIG_NO_ALIAS)
+
+extern void __pi_irq_handler_stub();
+extern void __pi_irq_fast_handler_stub();
+
+// Return the jal x0 instruction jumping from slot to target, or 0 if it is out of reach
+static uint32_t __pi_irq_jump_encode(uintptr_t slot, uintptr_t target)
+{
+    int32_t offset = target - slot;
+
+    if (offset < -(1 << 20) || offset >= (1 << 20))
+    {
+        return 0;
+    }
+
+    // J-type immediate is imm[20|10:1|11|19:12] in bits 31:12, with rd=x0
+    return (((offset >> 20) & 0x1) << 31) | (((offset >> 1) & 0x3ff) << 21) |
+        (((offset >> 11) & 0x1) << 20) | (((offset >> 12) & 0xff) << 12) | 0x6f;
+}
+
+// Patch the slot of both vector tables, the normal one which is used while the core is active
+// and the fast one which is used while it is sleeping
+static int __pi_irq_vector_set(int irq, uintptr_t handler, uintptr_t fast_handler)
+{
+    uint32_t *vector = (uint32_t *)__pi_linker_irq_vector_base() + irq;
+    uint32_t insn = __pi_irq_jump_encode((uintptr_t)vector, handler);
+
+    if (insn == 0)
+    {
+        return -1;
+    }
+
+    uint32_t *fast_vector = (uint32_t *)__pi_linker_fast_irq_vector_base() + irq;
+    uint32_t fast_insn = __pi_irq_jump_encode((uintptr_t)fast_vector, fast_handler);
+
+    if (fast_insn == 0)
+    {
+        return -1;
+    }
+
+    if (*vector != insn || *fast_vector != fast_insn)
+    {
+        *vector = insn;
+        *fast_vector = fast_insn;
+        // Make sure the core does not execute the old instructions
+        asm volatile ("fence.i" : : : "memory");
+    }
+
+    return 0;
+}
+
+int pi_irq_handler_set_fast(int irq, void (*handler)())
+{
+    __pi_irq_kernel_check_install();
+
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+    __pi_irq_fast_lines |= 1 << irq;
+#endif
+
+    return __pi_irq_vector_set(irq, (uintptr_t)handler, (uintptr_t)handler);
+}
+
+#endif
+
+static void __pi_irq_kernel_check_handler(void *arg)
+{
+    // Nothing to do, the stub is doing the kernel checks when this handler returns
+}
+
+// The line used to request the kernel checks is only installed once it is needed
+void __pi_irq_kernel_check_install()
+{
+    if (__pi_irq_handlers[FC_IRQ_KERNEL_CHECK] != (uint_t)__pi_irq_kernel_check_handler)
+    {
+        pi_irq_handler_set(FC_IRQ_KERNEL_CHECK, __pi_irq_kernel_check_handler, NULL);
+        pi_irq_enable(FC_IRQ_KERNEL_CHECK);
+    }
+}
+
+void __pi_irq_kernel_check_request()
+{
+    __pi_irq_check_pending = 0;
+    __pi_irq_kernel_check_install();
+    pi_irq_set(FC_IRQ_KERNEL_CHECK);
+}
+
 void pi_irq_handler_set(int irq, void (*handler)(void *arg), void *arg)
 {
     __pi_irq_handlers[irq] = (long)handler;
     __pi_irq_handlers_arg[irq] = (long)arg;
+
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+    __pi_irq_fast_lines &= ~(1 << irq);
+#endif
+
+#if defined(CHIP_HAS_ALIAS) && !defined(CONFIG_NO_ALIAS)
+    // Go back to the common stubs in case a fast handler was set
+    __pi_irq_vector_set(irq, (uintptr_t)__pi_irq_handler_stub,
+        (uintptr_t)__pi_irq_fast_handler_stub);
+#endif
+}
+
+// Number of handlers and level critical sections being executed, the kernel checks are only
+// done by an handler when it is the only one
+PI_MEMORY_TINY int __pi_irq_nesting;
+// Set when an handler could not do the kernel checks
+PI_MEMORY_TINY char __pi_irq_check_pending;
+// For each priority, mask of the lines which are masked by a level critical section
+uint32_t __pi_irq_level_lock_masks[PI_IRQ_NB_PRIORITIES] = { [0 ... PI_IRQ_NB_PRIORITIES - 1] = -1 };
+static uint8_t __pi_irq_priorities[32];
+
+#if !defined(CONFIG_IRQ_NESTED) && defined(CONFIG_IRQ_LEVEL_LOCK)
+PI_MEMORY_TINY uint32_t __pi_irq_level_locked;
+#endif
+
+#if defined(CONFIG_IRQ_NESTED)
+PI_MEMORY_TINY uint32_t __pi_irq_enabled;
+PI_MEMORY_TINY uint32_t __pi_irq_allowed = -1;
+// For each line, mask of the lines which can preempt its handler
+PI_MEMORY_TINY uint32_t __pi_irq_level_masks[32];
+// Mask of the lines which can preempt event callbacks, i.e. all lines with a priority
+static uint32_t __pi_irq_preempt_mask;
+#endif
+
+int pi_irq_priority_set(int irq, int priority)
+{
+    if (priority < 0 || priority >= PI_IRQ_NB_PRIORITIES)
+    {
+        return -1;
+    }
+
+    int state = pi_irq_lock();
+
+    __pi_irq_priorities[irq] = priority;
+
+    for (int level = 0; level < PI_IRQ_NB_PRIORITIES; level++)
+    {
+        uint32_t mask = 0;
+        for (int i = 0; i < 32; i++)
+        {
+            if (__pi_irq_priorities[i] <= level)
+            {
+                mask |= 1 << i;
+            }
+        }
+        __pi_irq_level_lock_masks[level] = mask;
+    }
+
+#if defined(CONFIG_IRQ_NESTED)
+    __pi_irq_preempt_mask = ~__pi_irq_level_lock_masks[0];
+    for (int i = 0; i < 32; i++)
+    {
+        __pi_irq_level_masks[i] = ~__pi_irq_level_lock_masks[__pi_irq_priorities[i]];
+    }
+#endif
+
+    pi_irq_unlock(state);
+
+    return 0;
+}
+
+#if defined(CONFIG_IRQ_NESTED)
+
+#if defined(CONFIG_EVENT)
+// Called by the outermost IRQ handler stub with interrupts disabled when there are pending event
+// callbacks
+void __pi_irq_nested_callbacks_exec()
+{
+    // Callbacks are executed with the lines having a priority enabled, so that a slow callback
+    // does not delay them. Nesting is kept raised so that these interrupts do not execute
+    // callbacks themselves.
+    __pi_irq_nesting++;
+
+    pi_evt_t *event;
+    while ((event = __pi_evt_ready_first) != NULL)
+    {
+        __pi_evt_ready_first = event->next;
+
+        __pi_irq_allowed = __pi_irq_preempt_mask;
+        itc_mask_set(SOC_FC_ITC_ADDR, __pi_irq_enabled & __pi_irq_allowed);
+        asm volatile ("csrsi %0, %1" :  : "I" (CSR_MSTATUS), "I" (1 << CSR_MSTATUS_MIE_BIT) : "memory");
+
+        event->callback(event);
+
+        asm volatile ("csrci %0, %1" :  : "I" (CSR_MSTATUS), "I" (1 << CSR_MSTATUS_MIE_BIT) : "memory");
+        __pi_irq_allowed = -1;
+        itc_mask_set(SOC_FC_ITC_ADDR, __pi_irq_enabled);
+    }
+
+    __pi_irq_nesting--;
+    // The stub is now doing the checks
+    __pi_irq_check_pending = 0;
+}
+#endif
+
+#endif
+
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+void __pi_irq_sleep_dispatch()
+{
+    // Interrupts are disabled, the core still wakes up as soon as an interrupt is pending, but
+    // continues after the wfi instead of trapping
+    asm volatile ("wfi" : : : "memory");
+
+    uint32_t pending;
+    while ((pending = itc_status_get(SOC_FC_ITC_ADDR) & itc_mask_get(SOC_FC_ITC_ADDR)) != 0)
+    {
+        if (pending & __pi_irq_fast_lines)
+        {
+            // Let the core trap to the fast handlers, it comes back here with mret
+            asm volatile ("csrsi %0, %1" :  : "I" (CSR_MSTATUS), "I" (1 << CSR_MSTATUS_MIE_BIT) : "memory");
+            asm volatile ("csrci %0, %1" :  : "I" (CSR_MSTATUS), "I" (1 << CSR_MSTATUS_MIE_BIT) : "memory");
+            continue;
+        }
+
+        // Same order as the core, the highest line first. Since the core is not acknowledging
+        // it, we have to clear it ourselves.
+        int irq = __FL1(pending);
+        itc_status_clr_set(SOC_FC_ITC_ADDR, 1 << irq);
+
+        ((void (*)(void *))__pi_irq_handlers[irq])((void *)__pi_irq_handlers_arg[irq]);
+    }
 }
+#endif
 
 void __pi_irq_init()
 {
@@ -8,10 +8,28 @@
 
 #include <pmsis/kernel/kernel.h>
 #include <kernel/riscv.h>
+#include <pmsis/kernel/memory.h>
 #include <arch/pulp/kernel/archi/itc.h>
 #include PI_CHIP_INC(CONFIG_CHIP_FAMILY_NAME, kernel/memory_map.h)
+#include PI_CHIP_INC(CONFIG_CHIP_FAMILY_NAME, kernel/properties.h)
+
+// Number of interrupt priority levels
+#define PI_IRQ_NB_PRIORITIES 4
 
 void __pi_irq_init();
+// Install the SW interrupt used to request the kernel checks
+void __pi_irq_kernel_check_install();
+// Raise the SW interrupt to request the kernel checks
+void __pi_irq_kernel_check_request();
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+// Wait for interrupts with interrupts disabled and execute the handlers of the pending ones
+// without trapping
+void __pi_irq_sleep_dispatch();
+#endif
+
+extern PI_MEMORY_TINY int __pi_irq_nesting;
+extern PI_MEMORY_TINY char __pi_irq_check_pending;
+extern uint32_t __pi_irq_level_lock_masks[];
 
 static inline int pi_irq_lock()
 {
@@ -29,6 +47,47 @@ static inline void pi_irq_unlock(int state)
     asm volatile ("csrw %0, %1" :  : "I" (CSR_MSTATUS), "r" (state));
 }
 
+#if defined(CONFIG_IRQ_NESTED)
+
+// Lines enabled by the user. The ITC mask is the subset of them which is allowed by the
+// priority of the handlers currently being executed.
+extern PI_MEMORY_TINY uint32_t __pi_irq_enabled;
+extern PI_MEMORY_TINY uint32_t __pi_irq_allowed;
+
+static inline void __pi_irq_mask_enable(uint32_t mask)
+{
+    int state = pi_irq_lock();
+    __pi_irq_enabled |= mask;
+    itc_mask_set(SOC_FC_ITC_ADDR, __pi_irq_enabled & __pi_irq_allowed);
+    pi_irq_unlock(state);
+}
+
+static inline void __pi_irq_mask_disable(uint32_t mask)
+{
+    int state = pi_irq_lock();
+    __pi_irq_enabled &= ~mask;
+    itc_mask_set(SOC_FC_ITC_ADDR, __pi_irq_enabled & __pi_irq_allowed);
+    pi_irq_unlock(state);
+}
+
+static inline void pi_irq_enable(int irq)
+{
+    __pi_irq_mask_enable(1 << irq);
+}
+
+static inline void pi_irq_disable(int irq)
+{
+    __pi_irq_mask_disable(1 << irq);
+}
+
+#else
+
+#if defined(CONFIG_IRQ_LEVEL_LOCK)
+// Lines masked by the level critical sections being executed, which must be enabled again when
+// they are left
+extern PI_MEMORY_TINY uint32_t __pi_irq_level_locked;
+#endif
+
 static inline void pi_irq_enable(int irq)
 {
     itc_mask_set_set(SOC_FC_ITC_ADDR, 1 << irq);
@@ -36,6 +95,10 @@ static inline void pi_irq_enable(int irq)
 
 static inline void pi_irq_disable(int irq)
 {
+#if defined(CONFIG_IRQ_LEVEL_LOCK)
+    // A line disabled during a level critical section must stay disabled when it is left
+    __pi_irq_level_locked &= ~(1 << irq);
+#endif
     itc_mask_clr_set(SOC_FC_ITC_ADDR, 1 << irq);
 }
 
@@ -46,14 +109,80 @@ static inline void __pi_irq_mask_enable(uint32_t mask)
 
 static inline void __pi_irq_mask_disable(uint32_t mask)
 {
+#if defined(CONFIG_IRQ_LEVEL_LOCK)
+    __pi_irq_level_locked &= ~mask;
+#endif
     itc_mask_clr_set(SOC_FC_ITC_ADDR, mask);
 }
 
+#endif
+
 static inline void __pi_irq_mask_clear(uint32_t mask)
 {
     itc_status_clr_set(SOC_FC_ITC_ADDR, mask);
 }
 
+#if defined(CONFIG_IRQ_LEVEL_LOCK)
+static inline int pi_irq_lock_level(int level)
+{
+    int irq = pi_irq_lock();
+    // Interrupts taken during the critical section must not do the kernel checks
+    __pi_irq_nesting++;
+#if defined(CONFIG_IRQ_NESTED)
+    int state = __pi_irq_allowed;
+    __pi_irq_allowed = state & ~__pi_irq_level_lock_masks[level];
+    itc_mask_set(SOC_FC_ITC_ADDR, __pi_irq_enabled & __pi_irq_allowed);
+#else
+    int state = itc_mask_get(SOC_FC_ITC_ADDR) & __pi_irq_level_lock_masks[level];
+    __pi_irq_level_locked |= state;
+    itc_mask_clr_set(SOC_FC_ITC_ADDR, state);
+#endif
+    // Read back the mask so that it is applied before interrupts are enabled again
+    (void)itc_mask_get(SOC_FC_ITC_ADDR);
+    pi_irq_unlock(irq);
+    return state;
+}
+
+static inline void pi_irq_unlock_level(int state)
+{
+    int irq = pi_irq_lock();
+#if defined(CONFIG_IRQ_NESTED)
+    __pi_irq_allowed = state;
+    itc_mask_set(SOC_FC_ITC_ADDR, __pi_irq_enabled & __pi_irq_allowed);
+#else
+    // Only restore the lines which were not disabled during the critical section
+    itc_mask_set_set(SOC_FC_ITC_ADDR, state & __pi_irq_level_locked);
+    __pi_irq_level_locked &= ~state;
+#endif
+    __pi_irq_nesting--;
+    if (__pi_irq_nesting == 0 && __pi_irq_check_pending)
+    {
+        __pi_irq_kernel_check_request();
+    }
+    pi_irq_unlock(irq);
+}
+#endif
+
+// Lock used by the kernel for its data structures. They are only accessed from handlers with
+// priority 0, so with nested interrupts, the higher priority ones are kept enabled.
+static inline int __pi_irq_kernel_lock()
+{
+#if defined(CONFIG_IRQ_NESTED)
+    return pi_irq_lock_level(0);
+#else
+    return pi_irq_lock();
+#endif
+}
+
+static inline void __pi_irq_kernel_unlock(int state)
+{
+#if defined(CONFIG_IRQ_NESTED)
+    pi_irq_unlock_level(state);
+#else
+    pi_irq_unlock(state);
+#endif
+}
+
 static inline void pi_irq_clear(int irq)
 {
     itc_status_clr_set(SOC_FC_ITC_ADDR, 1 << irq);
@@ -63,3 +192,36 @@ static inline void pi_irq_set(int irq)
 {
     itc_status_set_set(SOC_FC_ITC_ADDR, 1 << irq);
 }
+
+#if defined(CHIP_HAS_ALIAS) && !defined(CONFIG_NO_ALIAS)
+/**
+ * @brief Set a fast interrupt routine.
+ *
+ * This function sets an interrupt handler which is directly called by the interrupt vector,
+ * without going through the common interrupt stub. No register is saved before the handler is
+ * called and nothing is checked after it, so the handler must be declared with
+ * __attribute__((interrupt)) so that the compiler saves only the registers it uses and returns
+ * with mret.
+ *
+ * Since the kernel does not get control back after such an handler, event callbacks pushed and
+ * threads woken up by the handler are not taken into account until the next interrupt. The
+ * handler can call pi_irq_fast_handler_check() if it needs them to be handled immediately.
+ *
+ * Calling pi_irq_handler_set() on the same interrupt goes back to the common interrupt stub.
+ *
+ * This is only available when the vector table can be patched, i.e. on chips with the
+ * memory alias.
+ *
+ * @param irq            Interrupt number.
+ * @param handler        Handler to execute.
+ * @return               0 if the handler was set, -1 if it is out of reach of the vector table.
+ */
+int pi_irq_handler_set_fast(int irq, void (*handler)());
+#endif
+
+static inline void pi_irq_fast_handler_check()
+{
+    // The kernel checks are done by the common stub when leaving an interrupt, just raise an
+    // interrupt with an empty handler which will be taken as soon as the fast handler returns.
+    pi_irq_set(FC_IRQ_KERNEL_CHECK);
+}
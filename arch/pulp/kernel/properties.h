@@ -30,7 +30,19 @@
 
 #define FC_CORE_ID     0
 
+// SW interrupt reserved by the kernel to do its checks after fast interrupt handlers
+#define FC_IRQ_KERNEL_CHECK                (7)
+
 #define FC_IRQ_TIMER0_LO_EVT               (10)
 #define FC_IRQ_TIMER0_HI_EVT               (11)
 #define FC_IRQ_TIMER1_LO_EVT               (12)
 #define FC_IRQ_TIMER1_HI_EVT               (13)
+#define FC_IRQ_SOC_EVENT                   (26)
+
+
+/*
+ * SoC events
+ */
+
+// Number of SoC events which can be pushed to the FC ITC FIFO
+#define CHIP_NB_SOC_EVENTS                 (256)
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdint.h>
+#include <pmsis/kernel/irq.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/soc_event.h>
+#include <arch/pulp/kernel/archi/itc.h>
+#include PI_CHIP_INC(CONFIG_CHIP_FAMILY_NAME, kernel/properties.h)
+#include PI_CHIP_INC(CONFIG_CHIP_FAMILY_NAME, kernel/memory_map.h)
+
+static void (*__pi_soc_event_handlers[CHIP_NB_SOC_EVENTS])(void *arg);
+static void *__pi_soc_event_handlers_arg[CHIP_NB_SOC_EVENTS];
+static int __pi_soc_event_installed;
+
+static void __pi_soc_event_handler(void *arg)
+{
+    uint32_t irq_mask = 1 << FC_IRQ_SOC_EVENT;
+
+    // The ITC raises the IRQ again as long as the FIFO is not empty. Pop all the events at once
+    // so that a burst of events from several channels only pays one IRQ entry.
+    // The status is cleared before each pop so that we see it again if more events are pushed.
+    do
+    {
+        itc_status_clr_set(SOC_FC_ITC_ADDR, irq_mask);
+
+        int event = itc_fifo_get(SOC_FC_ITC_ADDR) & (CHIP_NB_SOC_EVENTS - 1);
+        void (*handler)(void *arg) = __pi_soc_event_handlers[event];
+
+        if (handler)
+        {
+            handler(__pi_soc_event_handlers_arg[event]);
+        }
+    }
+    while (itc_status_get(SOC_FC_ITC_ADDR) & irq_mask);
+}
+
+void pi_soc_event_handler_set(int event, void (*handler)(void *), void *arg)
+{
+    int irq = pi_irq_lock();
+
+    __pi_soc_event_handlers[event] = handler;
+    __pi_soc_event_handlers_arg[event] = arg;
+
+    // The FIFO interrupt is only used once a first SoC event is attached
+    if (!__pi_soc_event_installed)
+    {
+        __pi_soc_event_installed = 1;
+        pi_irq_handler_set(FC_IRQ_SOC_EVENT, __pi_soc_event_handler, NULL);
+        pi_irq_enable(FC_IRQ_SOC_EVENT);
+    }
+
+    pi_irq_unlock(irq);
+}
+
+#if defined(CONFIG_EVENT)
+static void __pi_soc_event_notify(void *arg)
+{
+    pi_evt_notify_unsafe((pi_evt_t *)arg);
+}
+
+void pi_soc_event_evt_set(int event, pi_evt_t *evt)
+{
+    pi_soc_event_handler_set(event, __pi_soc_event_notify, (void *)evt);
+}
+#endif
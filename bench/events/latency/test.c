@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <pmsis/kernel/cycle.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/irq.h>
+
+/*
+ * Benchmark: interrupt latency and jitter
+ *
+ * Each iteration takes a timestamp right before pi_irq_set, then on the first instruction of
+ * the IRQ handler and on the first instruction of the event callback notified by the handler.
+ * This gives for each interrupt:
+ * - the IRQ latency, from pi_irq_set to the handler,
+ * - the dispatch latency, from the handler to the event callback,
+ * - the callback latency, from pi_irq_set to the event callback.
+ *
+ * Instead of the average only, the distribution of each latency is reported as an histogram
+ * together with the worst case, since the worst case is what bounds a control loop.
+ *
+ * The benchmark is run while the core is active, while the core is sleeping in the fast vector
+ * path, and while the core is inside a critical section with interrupts locked. It is also run
+ * with a fast handler directly called from the interrupt vector.
+ */
+
+#define NB_ITER 200
+
+// Histogram buckets are HIST_STEP cycles wide, the last one gathers everything above
+#define HIST_STEP 16
+#define HIST_NB_BUCKETS 16
+
+typedef struct
+{
+    uint32_t total;
+    uint32_t worst;
+    uint32_t hist[HIST_NB_BUCKETS];
+} latency_t;
+
+static latency_t irq_latency;
+static latency_t dispatch_latency;
+static latency_t callback_latency;
+
+static uint32_t set_stamp;
+static uint32_t irq_stamp;
+
+static int iter;
+static pi_evt_t end_event;
+
+static void latency_reset(latency_t *latency)
+{
+    latency->total = 0;
+    latency->worst = 0;
+    for (int i = 0; i < HIST_NB_BUCKETS; i++)
+    {
+        latency->hist[i] = 0;
+    }
+}
+
+static void latency_record(latency_t *latency, uint32_t value)
+{
+    latency->total += value;
+    if (value > latency->worst)
+    {
+        latency->worst = value;
+    }
+
+    uint32_t bucket = value / HIST_STEP;
+    if (bucket >= HIST_NB_BUCKETS)
+    {
+        bucket = HIST_NB_BUCKETS - 1;
+    }
+    latency->hist[bucket]++;
+}
+
+static void latency_dump(const char *group, const char *name, latency_t *latency)
+{
+    printf("    [%s] Average %s latency: %f\n", group, name, (float)latency->total / NB_ITER);
+    printf("    [%s] Worst %s latency: %d\n", group, name, latency->worst);
+    printf("    [%s] Histogram of %s latency:\n", group, name);
+    for (int i = 0; i < HIST_NB_BUCKETS; i++)
+    {
+        if (latency->hist[i])
+        {
+            if (i == HIST_NB_BUCKETS - 1)
+            {
+                printf("        %4d+     : %d\n", i * HIST_STEP, latency->hist[i]);
+            }
+            else
+            {
+                printf("        %4d-%4d : %d\n", i * HIST_STEP, (i + 1) * HIST_STEP - 1,
+                    latency->hist[i]);
+            }
+        }
+    }
+}
+
+static void irq_handler(void *arg)
+{
+    irq_stamp = pi_cycle_get32();
+    pi_evt_notify_unsafe((pi_evt_t *)arg);
+}
+
+static void raise_irq()
+{
+    set_stamp = pi_cycle_get32();
+    pi_irq_set(1);
+}
+
+static void callback_record()
+{
+    uint32_t callback_stamp = pi_cycle_get32();
+    latency_record(&irq_latency, irq_stamp - set_stamp);
+    latency_record(&dispatch_latency, callback_stamp - irq_stamp);
+    latency_record(&callback_latency, callback_stamp - set_stamp);
+}
+
+
+/*
+ * Mode 0: core active
+ * The IRQ is raised with interrupts enabled and is taken immediately, the callback is executed
+ * when the IRQ handler returns, with the full interrupt save and restore.
+ */
+
+static void active_callback(pi_evt_t *evt)
+{
+    callback_record();
+}
+
+static void bench_active(pi_evt_t *event)
+{
+    for (int i = 0; i < NB_ITER; i++)
+    {
+        pi_evt_cb_init(event, active_callback);
+        raise_irq();
+    }
+}
+
+
+/*
+ * Mode 1: core sleeping
+ * The main thread waits with interrupts locked and each callback raises the next IRQ, so that it
+ * is only taken once the core went to sleep and is handled through the fast vectors. The IRQ
+ * latency then also includes the time for the core to go back to sleep after the callback, the
+ * dispatch latency is the wake-up path only.
+ */
+
+static void idle_callback(pi_evt_t *evt)
+{
+    callback_record();
+
+    iter--;
+    if (iter == 0)
+    {
+        pi_evt_notify(&end_event);
+    }
+    else
+    {
+        pi_evt_cb_init(evt, idle_callback);
+        raise_irq();
+    }
+}
+
+static void bench_idle(pi_evt_t *event)
+{
+    int irq_state = pi_irq_lock();
+
+    iter = NB_ITER;
+    pi_evt_sig_init(&end_event);
+    pi_evt_cb_init(event, idle_callback);
+    raise_irq();
+    pi_evt_sig_wait_unsafe(&end_event);
+
+    pi_irq_unlock(irq_state);
+}
+
+
+/*
+ * Mode 2: critical section
+ * The IRQ is raised at the beginning of a critical section with interrupts locked, and is only
+ * taken when the critical section is left. This shows how a critical section of a given length
+ * adds up to the IRQ latency.
+ */
+
+#define CRITICAL_NB_LOOPS 16
+
+static void bench_locked(pi_evt_t *event)
+{
+    for (int i = 0; i < NB_ITER; i++)
+    {
+        pi_evt_cb_init(event, active_callback);
+
+        int irq_state = pi_irq_lock();
+        raise_irq();
+        for (volatile int j = 0; j < CRITICAL_NB_LOOPS; j++);
+        pi_irq_unlock(irq_state);
+    }
+}
+
+
+/*
+ * Mode 3: fast handler
+ * Same as mode 0, except that the IRQ handler is directly called from the interrupt vector
+ * instead of going through the common stub, and then requests the kernel checks so that the
+ * callback is executed.
+ */
+
+static pi_evt_t *fast_event;
+
+static void __attribute__((interrupt)) fast_irq_handler(void)
+{
+    irq_stamp = pi_cycle_get32();
+    pi_evt_notify_unsafe(fast_event);
+    pi_irq_fast_handler_check();
+}
+
+static void bench_fast(pi_evt_t *event)
+{
+    fast_event = event;
+    pi_irq_handler_set_fast(1, fast_irq_handler);
+
+    bench_active(event);
+
+    // Go back to the common stub for the next modes
+    pi_irq_handler_set(1, irq_handler, (void *)event);
+}
+
+
+static void bench_latency(const char *group, void (*bench)(pi_evt_t *event))
+{
+    pi_evt_t event;
+
+    printf("Benchmarking interrupt latency (%s)\n", group);
+
+    pi_cycle_start();
+
+    pi_irq_handler_set(1, irq_handler, (void *)&event);
+    pi_irq_enable(1);
+
+    for (int j = 0; j < 3; j++)
+    {
+        latency_reset(&irq_latency);
+        latency_reset(&dispatch_latency);
+        latency_reset(&callback_latency);
+
+        bench(&event);
+    }
+
+    pi_irq_disable(1);
+    pi_cycle_stop();
+
+    latency_dump(group, "IRQ", &irq_latency);
+    latency_dump(group, "dispatch", &dispatch_latency);
+    latency_dump(group, "callback", &callback_latency);
+    printf("\n");
+}
+
+
+int main()
+{
+    bench_latency("active", bench_active);
+    bench_latency("idle", bench_idle);
+    bench_latency("locked", bench_locked);
+    bench_latency("fast", bench_fast);
+
+    return 0;
+}
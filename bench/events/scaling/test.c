@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <pmsis/kernel/cycle.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/time.h>
+#include <pmsis/kernel/irq.h>
+#include <arch/gap/gap9/kernel/perf.h>
+
+/*
+ * Benchmark: delayed event push and cancel cost versus number of pending events
+ *
+ * The timer list is first filled with N-1 pending delayed events, then the cost of pushing one
+ * more event with pi_evt_notify_delayed and of cancelling it with pi_evt_timed_cancel is
+ * measured separately. The measured event has the furthest deadline so that it is inserted at
+ * the tail of the list, which is the worst case for a sorted list. The sweep covers N from 1 to
+ * 1024 so that the resulting curves show how the timer structures scale.
+ *
+ * Deadlines are far enough in the future so that no event fires during the measurement.
+ */
+
+#define NB_ITER 50
+#define MAX_EVENTS 1024
+#define DELAY_US 10000000
+
+static pi_evt_t events[MAX_EVENTS];
+
+static void empty_callback(pi_evt_t *evt) {}
+
+static void dump(const char *op, int nb_events)
+{
+    printf("    [%s_%d] Cycles per iteration: %f\n", op, nb_events,
+        (float)pi_cycle_get32() / NB_ITER);
+    printf("    [%s_%d] Active cycles per iteration: %f\n", op, nb_events,
+        (float)pi_perf_read(PI_PERF_ACTIVE_CYCLES) / NB_ITER);
+    printf("    [%s_%d] Instructions per iteration: %f\n", op, nb_events,
+        (float)pi_perf_read(PI_PERF_INSTR) / NB_ITER);
+}
+
+static void bench_scaling(int nb_events)
+{
+    pi_evt_t event;
+
+    printf("Benchmarking delayed event push and cancel cost (%d pending events)\n", nb_events);
+
+    // Fill the timer list with the other pending events, with increasing deadlines
+    for (int i = 0; i < nb_events - 1; i++)
+    {
+        pi_evt_notify_delayed(pi_evt_cb_init(&events[i], empty_callback), DELAY_US + i);
+    }
+
+    pi_perf_enable((1 << PI_PERF_ACTIVE_CYCLES) | (1 << PI_PERF_INSTR));
+
+    // Push cost, the cancel is done outside the measurement
+    for (int j = 0; j < 3; j++)
+    {
+        pi_cycle_reset();
+        pi_perf_reset();
+
+        for (int i = 0; i < NB_ITER; i++)
+        {
+            pi_evt_cb_init(&event, empty_callback);
+
+            pi_cycle_start();
+            pi_perf_start();
+            pi_evt_notify_delayed(&event, DELAY_US + MAX_EVENTS);
+            pi_perf_stop();
+            pi_cycle_stop();
+
+            pi_evt_timed_cancel(&event);
+        }
+    }
+
+    dump("push", nb_events);
+
+    // Cancel cost, the push is done outside the measurement
+    for (int j = 0; j < 3; j++)
+    {
+        pi_cycle_reset();
+        pi_perf_reset();
+
+        for (int i = 0; i < NB_ITER; i++)
+        {
+            pi_evt_notify_delayed(pi_evt_cb_init(&event, empty_callback), DELAY_US + MAX_EVENTS);
+
+            pi_cycle_start();
+            pi_perf_start();
+            pi_evt_timed_cancel(&event);
+            pi_perf_stop();
+            pi_cycle_stop();
+        }
+    }
+
+    dump("cancel", nb_events);
+    printf("\n");
+
+    for (int i = 0; i < nb_events - 1; i++)
+    {
+        pi_evt_timed_cancel(&events[i]);
+    }
+}
+
+int main()
+{
+    for (int nb_events = 1; nb_events <= MAX_EVENTS; nb_events *= 4)
+    {
+        bench_scaling(nb_events);
+    }
+
+    return 0;
+}
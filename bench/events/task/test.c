@@ -0,0 +1,295 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <pmsis/kernel/cycle.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/time.h>
+#include <pmsis/kernel/irq.h>
+#include <arch/gap/gap9/kernel/perf.h>
+
+// Latency is measured from the push of the task event in the IRQ handler to the first
+// instruction of the task.
+static uint32_t latency_start;
+static uint32_t latency_total;
+static uint32_t latency_worst;
+
+static void latency_record()
+{
+    uint32_t latency = pi_cycle_get32() - latency_start;
+    latency_total += latency;
+    if (latency > latency_worst)
+    {
+        latency_worst = latency;
+    }
+}
+
+static void latency_irq_handler(void *arg)
+{
+    pi_evt_t *evt = (pi_evt_t *)arg;
+    latency_start = pi_cycle_get32();
+    pi_evt_notify_unsafe(evt);
+}
+
+static void latency_dump(const char *group, int nb_iter)
+{
+    printf("    [%s] Average latency: %f\n", group, (float)latency_total / nb_iter);
+    printf("    [%s] Worst latency: %d\n", group, latency_worst);
+    printf("    [%s] Active cycles per task: %f\n", group,
+        (float)pi_perf_read(PI_PERF_ACTIVE_CYCLES) / nb_iter);
+    printf("    [%s] Instructions per task: %f\n", group,
+        (float)pi_perf_read(PI_PERF_INSTR) / nb_iter);
+    printf("\n");
+}
+
+
+/*
+ * Benchmark 0: push-to-execution latency while the target thread is sleeping
+ * An IRQ handler notifies a task event targeting the main thread, which is blocked in
+ * pi_evt_sig_wait and sleeping. Each task re-arms the next iteration and raises the IRQ with
+ * interrupts disabled, so that the IRQ is only taken once the thread went back to sleep.
+ * This covers the fast IRQ path, __pi_evt_push_task, the wake-up of the thread and the task loop.
+ */
+
+#define IDLE_NB_ITER 200
+
+static int idle_iter;
+static pi_evt_t idle_end_event;
+
+static void idle_task(pi_evt_t *evt)
+{
+    latency_record();
+
+    idle_iter--;
+    if (idle_iter == 0)
+    {
+        pi_evt_notify(&idle_end_event);
+    }
+    else
+    {
+        pi_evt_task_init(evt, idle_task, NULL);
+        // Tasks are executed with interrupts enabled, disable them so that the interrupt
+        // is delayed until the thread is sleeping. The task loop disables them anyway when
+        // the task returns.
+        pi_irq_lock();
+        pi_irq_set(1);
+    }
+}
+
+static void bench_task_idle()
+{
+    pi_evt_t event;
+
+    printf("Benchmarking task push-to-execution while thread is sleeping\n");
+
+    pi_perf_enable((1 << PI_PERF_ACTIVE_CYCLES) | (1 << PI_PERF_INSTR));
+    pi_cycle_start();
+
+    pi_irq_handler_set(1, latency_irq_handler, (void *)&event);
+    pi_irq_enable(1);
+
+    for (int j = 0; j < 3; j++)
+    {
+        latency_total = 0;
+        latency_worst = 0;
+        idle_iter = IDLE_NB_ITER;
+        pi_evt_sig_init(&idle_end_event);
+        pi_evt_task_init(&event, idle_task, NULL);
+
+        pi_perf_reset();
+        pi_perf_start();
+
+        int irq_state = pi_irq_lock();
+        pi_irq_set(1);
+        pi_evt_sig_wait_unsafe(&idle_end_event);
+        pi_irq_unlock(irq_state);
+
+        pi_perf_stop();
+    }
+
+    pi_irq_disable(1);
+    pi_cycle_stop();
+
+    latency_dump("idle", IDLE_NB_ITER);
+}
+
+
+/*
+ * Benchmark 1: push-to-execution latency while the target thread is running
+ * Same as benchmark 0, except that the IRQ is raised with interrupts enabled from the task
+ * itself, so that it is taken immediately while the thread is executing its task loop. The next
+ * task is then executed as soon as the current one returns, without any sleep or wake-up.
+ */
+
+#define RUNNING_NB_ITER 200
+
+static int running_iter;
+static pi_evt_t running_end_event;
+
+static void running_task(pi_evt_t *evt)
+{
+    latency_record();
+
+    running_iter--;
+    if (running_iter == 0)
+    {
+        pi_evt_notify(&running_end_event);
+    }
+    else
+    {
+        pi_evt_task_init(evt, running_task, NULL);
+        pi_irq_set(1);
+    }
+}
+
+static void bench_task_running()
+{
+    pi_evt_t event;
+
+    printf("Benchmarking task push-to-execution while thread is running\n");
+
+    pi_perf_enable((1 << PI_PERF_ACTIVE_CYCLES) | (1 << PI_PERF_INSTR));
+    pi_cycle_start();
+
+    pi_irq_handler_set(1, latency_irq_handler, (void *)&event);
+    pi_irq_enable(1);
+
+    for (int j = 0; j < 3; j++)
+    {
+        latency_total = 0;
+        latency_worst = 0;
+        running_iter = RUNNING_NB_ITER;
+        pi_evt_sig_init(&running_end_event);
+        pi_evt_task_init(&event, running_task, NULL);
+
+        pi_perf_reset();
+        pi_perf_start();
+
+        pi_irq_set(1);
+        pi_evt_sig_wait(&running_end_event);
+
+        pi_perf_stop();
+    }
+
+    pi_irq_disable(1);
+    pi_cycle_stop();
+
+    latency_dump("running", RUNNING_NB_ITER);
+}
+
+
+/*
+ * Benchmark 2: sustained throughput
+ * A burst of empty tasks is pushed from thread context to one or several worker threads, and
+ * the main thread waits until the last one has been executed. This gives the amortized cost of
+ * the whole task path: notification, push to the thread queue, thread scheduling and execution.
+ * With several workers, this also includes the context switches between them.
+ */
+
+#define THROUGHPUT_NB_TASKS 1000
+#define THROUGHPUT_NB_WORKERS 4
+#define THROUGHPUT_STACK_SIZE 1024
+
+static pi_evt_t throughput_tasks[THROUGHPUT_NB_TASKS];
+static int throughput_pending;
+static pi_evt_t throughput_end_event;
+
+static pi_thread_t workers[THROUGHPUT_NB_WORKERS];
+static pi_evt_t workers_stop[THROUGHPUT_NB_WORKERS];
+static pi_evt_t workers_exit[THROUGHPUT_NB_WORKERS];
+static char workers_stack[THROUGHPUT_NB_WORKERS][THROUGHPUT_STACK_SIZE];
+
+static void throughput_task(pi_evt_t *evt)
+{
+    // Tasks are executed with interrupts enabled and workers can be preempted
+    int irq_state = pi_irq_lock();
+    throughput_pending--;
+    if (throughput_pending == 0)
+    {
+        pi_evt_notify_unsafe(&throughput_end_event);
+    }
+    pi_irq_unlock(irq_state);
+}
+
+static void worker_entry(void *arg)
+{
+    // Workers only execute tasks while they are waiting for the stop request
+    pi_evt_sig_wait((pi_evt_t *)arg);
+}
+
+static void bench_task_throughput(const char *group, int nb_workers)
+{
+    printf("Benchmarking task throughput (%s)\n", group);
+
+    for (int i = 0; i < nb_workers; i++)
+    {
+        pi_thread_create(&workers[i], "worker", worker_entry, pi_evt_sig_init(&workers_stop[i]),
+            0, workers_stack[i], THROUGHPUT_STACK_SIZE, pi_evt_sig_init(&workers_exit[i]));
+    }
+
+    // Let the workers start and block on their stop event before measuring
+    pi_thread_yield();
+
+    pi_perf_enable((1 << PI_PERF_ACTIVE_CYCLES) | (1 << PI_PERF_INSTR));
+    pi_cycle_start();
+
+    uint64_t start_time, duration = 0;
+
+    for (int j = 0; j < 3; j++)
+    {
+        throughput_pending = THROUGHPUT_NB_TASKS;
+        pi_evt_sig_init(&throughput_end_event);
+
+        start_time = pi_time_get_us();
+
+        pi_cycle_reset();
+        pi_perf_reset();
+        pi_perf_start();
+
+        for (int i = 0; i < THROUGHPUT_NB_TASKS; i++)
+        {
+            pi_evt_notify(pi_evt_task_init(&throughput_tasks[i], throughput_task,
+                nb_workers ? &workers[i % nb_workers] : NULL));
+        }
+
+        pi_evt_sig_wait(&throughput_end_event);
+
+        pi_perf_stop();
+
+        duration = pi_time_get_us() - start_time;
+    }
+
+    pi_cycle_stop();
+
+    for (int i = 0; i < nb_workers; i++)
+    {
+        pi_evt_notify(&workers_stop[i]);
+        pi_evt_sig_wait(&workers_exit[i]);
+    }
+
+    printf("    [%s] Cycles per task: %f\n", group,
+        (float)pi_cycle_get32() / THROUGHPUT_NB_TASKS);
+    printf("    [%s] Active cycles per task: %f\n", group,
+        (float)pi_perf_read(PI_PERF_ACTIVE_CYCLES) / THROUGHPUT_NB_TASKS);
+    printf("    [%s] Instructions per task: %f\n", group,
+        (float)pi_perf_read(PI_PERF_INSTR) / THROUGHPUT_NB_TASKS);
+    printf("    [%s] Tasks per second: %f\n", group,
+        (float)THROUGHPUT_NB_TASKS * 1000000 / (float)duration);
+    printf("\n");
+}
+
+
+int main()
+{
+    bench_task_idle();
+    bench_task_running();
+    // With no worker, tasks are executed by the main thread itself
+    bench_task_throughput("throughput_1", 0);
+    bench_task_throughput("throughput_n", THROUGHPUT_NB_WORKERS);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <pmsis/kernel/cycle.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/irq.h>
+#include <arch/gap/gap9/kernel/perf.h>
+
+/*
+ * Benchmark: thread wake-up latency through signal events
+ *
+ * Main thread A notifies a signal event (ping) which thread B is waiting for, then waits for a
+ * second signal event (pong) which B notifies back once it has been woken up. Each iteration
+ * is a round-trip with 2 wake-ups, covering __pi_evt_handle_signal,
+ * __pi_thread_unblock_waiting, the reschedule check and __pi_thread_switch.
+ *
+ * The benchmark is run with B at the same priority as A and at a higher priority, and with
+ * the notifications done either directly from thread context, or from an IRQ handler raised
+ * with pi_irq_set, in which case the switch to B is done when leaving the interrupt handler.
+ */
+
+#define NB_ITER 200
+
+static char stack_b[2048];
+
+static pi_evt_t ping;
+static pi_evt_t pong;
+
+static int notify_from_irq;
+// Event to be notified by the IRQ handler
+static pi_evt_t *volatile irq_event;
+
+static void irq_handler(void *arg)
+{
+    pi_evt_notify_unsafe(irq_event);
+}
+
+static void notify(pi_evt_t *event)
+{
+    if (notify_from_irq)
+    {
+        irq_event = event;
+        pi_irq_set(1);
+    }
+    else
+    {
+        pi_evt_notify(event);
+    }
+}
+
+static void thread_b_entry(void *arg)
+{
+    for (int i = 0; i < NB_ITER; i++)
+    {
+        pi_evt_sig_wait(&ping);
+        // Thread A only notifies ping again once it received pong, so it can safely be
+        // re-armed before notifying pong
+        pi_evt_sig_init(&ping);
+        notify(&pong);
+    }
+
+    pi_thread_exit(0);
+}
+
+static void bench_pingpong(const char *group, int priority, int use_irq)
+{
+    pi_thread_t thread_b;
+    pi_evt_t thread_b_done;
+
+    printf("Benchmarking signal event ping-pong (%s)\n", group);
+
+    notify_from_irq = use_irq;
+    pi_irq_handler_set(1, irq_handler, NULL);
+    pi_irq_enable(1);
+
+    pi_perf_enable((1 << PI_PERF_ACTIVE_CYCLES) | (1 << PI_PERF_INSTR));
+    pi_cycle_start();
+
+    for (int j = 0; j < 3; j++)
+    {
+        pi_evt_sig_init(&ping);
+
+        pi_thread_create(&thread_b, "b", thread_b_entry, NULL, priority,
+                         stack_b, sizeof(stack_b), pi_evt_sig_init(&thread_b_done));
+
+        pi_cycle_reset();
+        pi_perf_reset();
+        pi_perf_start();
+
+        for (int i = 0; i < NB_ITER; i++)
+        {
+            pi_evt_sig_init(&pong);
+            notify(&ping);
+            pi_evt_sig_wait(&pong);
+        }
+
+        pi_perf_stop();
+
+        pi_evt_sig_wait(&thread_b_done);
+    }
+
+    pi_cycle_stop();
+    pi_irq_disable(1);
+
+    // Each iteration wakes up B and then A, so there are 2 wake-ups per iteration.
+    printf("    [%s] Cycles per wakeup: %f\n", group,
+        (float)pi_cycle_get32() / (NB_ITER * 2));
+    printf("    [%s] Active cycles per wakeup: %f\n", group,
+        (float)pi_perf_read(PI_PERF_ACTIVE_CYCLES) / (NB_ITER * 2));
+    printf("    [%s] Instructions per wakeup: %f\n", group,
+        (float)pi_perf_read(PI_PERF_INSTR) / (NB_ITER * 2));
+    printf("\n");
+}
+
+int main()
+{
+    // Main thread is running at priority 0
+    bench_pingpong("same_thread", 0, 0);
+    bench_pingpong("cross_thread", 1, 0);
+    bench_pingpong("same_irq", 0, 1);
+    bench_pingpong("cross_irq", 1, 1);
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <pmsis/kernel/cycle.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/irq.h>
+#include <arch/gap/gap9/kernel/perf.h>
+
+/*
+ * Benchmark: context switch cost versus number of ready threads
+ *
+ * N worker threads at the same priority yield to each other in a ring, while the main thread
+ * is blocked waiting for them. Every yield goes through __pi_thread_switch_to_next with N
+ * threads in the ready queue. The sweep covers N from 2 to 64 and each of the priority levels,
+ * so that the resulting curves show whether the cost of a switch depends on the number of
+ * threads or on the queue they are in.
+ *
+ * The counters are started by the last thread reaching the start barrier and stopped by the
+ * first thread which is done, so that the measurement only covers switches with the full ring.
+ */
+
+#define NB_ITER 100
+#define MAX_THREADS 64
+#define STACK_SIZE 768
+
+static pi_thread_t threads[MAX_THREADS];
+static pi_evt_t threads_exit[MAX_THREADS];
+static char threads_stack[MAX_THREADS][STACK_SIZE];
+
+static int nb_threads;
+static volatile int nb_started;
+static volatile int measuring;
+static volatile unsigned int nb_switches;
+static unsigned int measured_switches;
+static uint32_t measured_cycles;
+
+static void thread_entry(void *arg)
+{
+    // Start barrier, wait until all threads are in the ready queue. The increment is protected
+    // since threads of the same priority can be preempted in the middle of it by the slice.
+    int irq = pi_irq_lock();
+    int started = ++nb_started;
+    pi_irq_unlock(irq);
+
+    if (started == nb_threads)
+    {
+        nb_switches = 0;
+        measuring = 1;
+        pi_cycle_reset();
+        pi_perf_reset();
+        pi_perf_start();
+    }
+
+    while (nb_started != nb_threads)
+    {
+        pi_thread_yield();
+    }
+
+    for (int i = 0; i < NB_ITER; i++)
+    {
+        nb_switches++;
+        pi_thread_yield();
+    }
+
+    if (measuring)
+    {
+        pi_perf_stop();
+        measured_cycles = pi_cycle_get32();
+        // The other threads keep on switching until they are done, only take the switches
+        // done so far
+        measured_switches = nb_switches;
+        measuring = 0;
+    }
+
+    pi_thread_exit(0);
+}
+
+static void bench_scaling(int priority, int nb)
+{
+    char group[32];
+    sprintf(group, "threads_%d_prio%d", nb, priority);
+
+    printf("Benchmarking context switch cost (%s)\n", group);
+
+    pi_perf_enable((1 << PI_PERF_ACTIVE_CYCLES) | (1 << PI_PERF_INSTR));
+    pi_cycle_start();
+
+    for (int j = 0; j < 3; j++)
+    {
+        nb_threads = nb;
+        nb_started = 0;
+
+        // Higher priority workers could preempt the main thread before all of them are created
+        // and would then spin forever on the start barrier, so create them all atomically
+        int irq_state = pi_irq_lock();
+        for (int i = 0; i < nb; i++)
+        {
+            pi_thread_create(&threads[i], "worker", thread_entry, NULL, priority,
+                threads_stack[i], STACK_SIZE, pi_evt_sig_init(&threads_exit[i]));
+        }
+        pi_irq_unlock(irq_state);
+
+        for (int i = 0; i < nb; i++)
+        {
+            pi_evt_sig_wait(&threads_exit[i]);
+        }
+    }
+
+    pi_cycle_stop();
+
+    printf("    [%s] Cycles per switch: %f\n", group,
+        (float)measured_cycles / measured_switches);
+    printf("    [%s] Active cycles per switch: %f\n", group,
+        (float)pi_perf_read(PI_PERF_ACTIVE_CYCLES) / measured_switches);
+    printf("    [%s] Instructions per switch: %f\n", group,
+        (float)pi_perf_read(PI_PERF_INSTR) / measured_switches);
+    printf("\n");
+}
+
+int main()
+{
+    for (int priority = 0; priority < 3; priority++)
+    {
+        for (int nb = 2; nb <= MAX_THREADS; nb *= 2)
+        {
+            bench_scaling(priority, nb);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/time.h>
+
+#define STACK_SIZE 1024
+#define DELAY      1000
+// Priority of the deadline level, given by kernel.threading.edf.priority
+#define EDF_PRIORITY 1
+
+static uint8_t stacks[2][STACK_SIZE];
+static pi_thread_t threads[2];
+static pi_evt_t start_events[2];
+static pi_evt_t end_events[2];
+
+static char order[2];
+static volatile int nb_run;
+static volatile int early_done;
+static volatile int late_preempted;
+
+static void order_entry(void *arg)
+{
+    // Wait until main releases both threads at the same time
+    pi_evt_sig_wait(&start_events[(int)arg]);
+    order[nb_run++] = 'a' + (int)arg;
+}
+
+static int check_order()
+{
+    nb_run = 0;
+
+    for (int i=0; i<2; i++)
+    {
+        pi_evt_sig_init(&start_events[i]);
+        // The thread runs until it waits for its start event, since it has a higher priority
+        // than main
+        if (pi_thread_create(&threads[i], "order", order_entry, (void *)i, EDF_PRIORITY,
+                stacks[i], STACK_SIZE, pi_evt_sig_init(&end_events[i]))) return -1;
+    }
+
+    // The second thread has the earliest deadline, it must run first even if it is released
+    // last
+    uint32_t now = pi_time_get_us();
+    pi_thread_deadline_set(&threads[0], now + 2*DELAY);
+    pi_thread_deadline_set(&threads[1], now + DELAY);
+
+    // Release both threads at once so that the first one can not run before the second one is
+    // ready
+    int irq = pi_irq_lock();
+    pi_evt_notify_unsafe(&start_events[0]);
+    pi_evt_notify_unsafe(&start_events[1]);
+    pi_irq_unlock(irq);
+
+    pi_evt_sig_wait(&end_events[0]);
+    pi_evt_sig_wait(&end_events[1]);
+
+    if (order[0] != 'b' || order[1] != 'a')
+    {
+        printf("Threads were not scheduled by deadline (order: %c%c)\n", order[0], order[1]);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void early_entry(void *arg)
+{
+    pi_evt_t event;
+
+    // Become ready from the timer interrupt, while the other thread is running
+    pi_evt_notify_delayed(pi_evt_sig_init(&event), DELAY);
+    pi_evt_sig_wait(&event);
+
+    early_done = 1;
+}
+
+static void late_entry(void *arg)
+{
+    pi_thread_deadline_set((pi_thread_t *)arg, (uint32_t)pi_time_get_us() + 100*DELAY);
+
+    // The other thread must preempt us as soon as it is ready since its deadline is earlier
+    uint64_t end = pi_time_get_us() + 4*DELAY;
+    while (!early_done && pi_time_get_us() < end);
+
+    late_preempted = early_done;
+}
+
+static int check_preemption()
+{
+    early_done = 0;
+    late_preempted = 0;
+
+    if (pi_thread_create(&threads[0], "early", early_entry, NULL, EDF_PRIORITY,
+            stacks[0], STACK_SIZE, pi_evt_sig_init(&end_events[0]))) return -1;
+
+    pi_thread_deadline_set(&threads[0], (uint32_t)pi_time_get_us() + 10*DELAY);
+
+    if (pi_thread_create(&threads[1], "late", late_entry, &threads[1], EDF_PRIORITY,
+            stacks[1], STACK_SIZE, pi_evt_sig_init(&end_events[1]))) return -1;
+
+    pi_evt_sig_wait(&end_events[0]);
+    pi_evt_sig_wait(&end_events[1]);
+
+    if (!late_preempted)
+    {
+        printf("Thread with earliest deadline did not preempt the running one\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    printf("Entered example\n");
+
+    if (check_order()) return -1;
+    if (check_preemption()) return -1;
+
+    printf("Test success\n");
+
+    return 0;
+}
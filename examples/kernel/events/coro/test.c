@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/coro.h>
+#include <pmsis/kernel/time.h>
+
+#define NB_YIELDS  3
+#define OP_DELAY   100
+#define DELAY      1000
+#define OP_STATUS  0x12
+
+typedef struct
+{
+    pi_coro_t coro;
+    int id;
+    int count;
+    uint64_t start;
+} test_coro_t;
+
+static int trace[2*NB_YIELDS];
+static int trace_index;
+static int errors;
+
+// Asynchronous operation notifying the coroutine event with a status after some time
+static pi_evt_t op_event;
+static pi_evt_t *op_done;
+
+static void op_handler(pi_evt_t *event)
+{
+    pi_evt_status_set(op_done, OP_STATUS);
+    pi_evt_notify(op_done);
+}
+
+static void op_start(pi_evt_t *done)
+{
+    op_done = done;
+    pi_evt_notify_delayed(pi_evt_cb_init(&op_event, op_handler), OP_DELAY);
+}
+
+static void coro_entry(pi_coro_t *coro)
+{
+    test_coro_t *test = (test_coro_t *)coro;
+
+    PI_CORO_BEGIN(coro);
+
+    // Both coroutines are on the same thread and must alternate at each yield
+    for (test->count=0; test->count<NB_YIELDS; test->count++)
+    {
+        trace[trace_index++] = test->id;
+        PI_CORO_YIELD(coro);
+    }
+
+    if (test->id == 0)
+    {
+        PI_CORO_AWAIT(coro, op_start(pi_coro_evt(coro)));
+
+        if (pi_evt_status_get(pi_coro_evt(coro)) != OP_STATUS)
+        {
+            printf("Wrong operation status\n");
+            errors++;
+        }
+
+        test->start = pi_time_get_us();
+        PI_CORO_DELAY(coro, DELAY);
+
+        if (pi_time_get_us() - test->start < DELAY)
+        {
+            printf("Delay too short\n");
+            errors++;
+        }
+    }
+
+    PI_CORO_END(coro);
+}
+
+int main()
+{
+    test_coro_t coro0 = { .id=0 }, coro1 = { .id=1 };
+    pi_evt_t end0, end1;
+
+    printf("Entered example\n");
+
+    pi_coro_start(&coro0.coro, coro_entry, NULL, NULL, pi_evt_sig_init(&end0));
+    pi_coro_start(&coro1.coro, coro_entry, NULL, NULL, pi_evt_sig_init(&end1));
+
+    // Waiting executes the coroutine tasks of the main thread
+    pi_evt_sig_wait(&end1);
+    pi_evt_sig_wait(&end0);
+
+    for (int i=0; i<2*NB_YIELDS; i++)
+    {
+        if (trace[i] != (i & 1))
+        {
+            printf("Coroutines did not alternate (index %d)\n", i);
+            errors++;
+        }
+    }
+
+    if (errors)
+    {
+        return -1;
+    }
+
+    printf("Test success\n");
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/event_group.h>
+#include <pmsis/kernel/time.h>
+
+static pi_evt_group_t group;
+
+// Timed callback setting flags from the timer interrupt handler
+typedef struct
+{
+    pi_evt_t event;
+    uint32_t flags;
+} flag_setter_t;
+
+static void flag_setter_handler(pi_evt_t *event)
+{
+    flag_setter_t *setter = (flag_setter_t *)event;
+    pi_evt_group_set_unsafe(&group, setter->flags);
+}
+
+static void flag_setter_start(flag_setter_t *setter, uint32_t flags, uint32_t delay)
+{
+    setter->flags = flags;
+    pi_evt_notify_delayed(pi_evt_cb_init(&setter->event, flag_setter_handler), delay);
+}
+
+int main()
+{
+    flag_setter_t setter0, setter1;
+    uint32_t flags;
+
+    printf("Entered example\n");
+
+    pi_evt_group_init(&group);
+
+    // Any of the flags, already set, the flags are kept
+    pi_evt_group_set(&group, 0x1);
+    flags = pi_evt_group_wait(&group, 0x3, 0);
+    if (flags != 0x1 || pi_evt_group_get(&group) != 0x1)
+    {
+        printf("Wrong any-wait result (flags 0x%x)\n", (unsigned int)flags);
+        return -1;
+    }
+
+    // Consumed flags are cleared
+    flags = pi_evt_group_wait(&group, 0x1, PI_EVT_GROUP_CLEAR);
+    if (flags != 0x1 || pi_evt_group_get(&group) != 0)
+    {
+        printf("Wrong clear result (flags 0x%x)\n", (unsigned int)flags);
+        return -1;
+    }
+
+    // Blocking any-wait, woken up by an interrupt handler
+    flag_setter_start(&setter0, 0x4, 100);
+    flags = pi_evt_group_wait(&group, 0x6, 0);
+    if (flags != 0x4)
+    {
+        printf("Wrong blocking any-wait result (flags 0x%x)\n", (unsigned int)flags);
+        return -1;
+    }
+
+    // All-wait only returns once both flags are set, and only clears the flags of its mask
+    flag_setter_start(&setter0, 0x10, 100);
+    flag_setter_start(&setter1, 0x20, 500);
+    flags = pi_evt_group_wait(&group, 0x30, PI_EVT_GROUP_WAIT_ALL | PI_EVT_GROUP_CLEAR);
+    if (flags != 0x34 || pi_evt_group_get(&group) != 0x4)
+    {
+        printf("Wrong all-wait result (flags 0x%x, group 0x%x)\n", (unsigned int)flags,
+            (unsigned int)pi_evt_group_get(&group));
+        return -1;
+    }
+
+    pi_evt_group_clear(&group, 0x4);
+    if (pi_evt_group_get(&group) != 0)
+    {
+        printf("Flags not cleared\n");
+        return -1;
+    }
+
+    printf("Test success\n");
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/future.h>
+#include <pmsis/kernel/time.h>
+
+#define NB_OPS 3
+
+// Asynchronous operation notifying an event with a status after some time
+typedef struct
+{
+    pi_evt_t event;
+    pi_evt_t *done;
+    int status;
+} test_op_t;
+
+static test_op_t ops[NB_OPS];
+static int continuation_status = -1;
+static pi_evt_t continuation_end;
+
+static void op_handler(pi_evt_t *event)
+{
+    test_op_t *op = (test_op_t *)event;
+    pi_evt_status_set(op->done, op->status);
+    pi_evt_notify(op->done);
+}
+
+static void op_start(test_op_t *op, pi_evt_t *done, int status, uint32_t delay)
+{
+    op->done = done;
+    op->status = status;
+    pi_evt_notify_delayed(pi_evt_cb_init(&op->event, op_handler), delay);
+}
+
+static void continuation_handler(pi_evt_t *event)
+{
+    continuation_status = pi_evt_status_get(event);
+    pi_evt_notify(&continuation_end);
+}
+
+static int test_then()
+{
+    pi_future_t future;
+    pi_evt_t continuation, signal;
+
+    // Continuation attached before completion, executed from the completing context
+    pi_evt_sig_init(&continuation_end);
+    op_start(&ops[0], pi_future_init(&future), 5, 100);
+    pi_future_then(&future, pi_evt_cb_init(&continuation, continuation_handler));
+    pi_evt_sig_wait(&continuation_end);
+
+    if (!pi_future_done(&future) || pi_future_status_get(&future) != 5 ||
+        continuation_status != 5)
+    {
+        printf("Wrong continuation status\n");
+        return -1;
+    }
+
+    // Continuation attached after completion, notified
+    pi_future_then(&future, pi_evt_sig_init(&signal));
+    pi_evt_sig_wait(&signal);
+
+    if (pi_evt_status_get(&signal) != 5)
+    {
+        printf("Wrong status after late continuation\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+static int test_when_all()
+{
+    pi_future_t futures[NB_OPS], result;
+    pi_future_t *list[NB_OPS];
+    pi_evt_t signal;
+
+    for (int i=0; i<NB_OPS; i++)
+    {
+        list[i] = &futures[i];
+        // Only the second operation fails, its status is the result one
+        op_start(&ops[i], pi_future_init(&futures[i]), i == 1 ? 7 : 0, 100 * (i + 1));
+    }
+
+    pi_future_when_all(&result, list, NB_OPS);
+    pi_future_then(&result, pi_evt_sig_init(&signal));
+    pi_evt_sig_wait(&signal);
+
+    for (int i=0; i<NB_OPS; i++)
+    {
+        if (!pi_future_done(&futures[i]))
+        {
+            printf("All futures should be completed\n");
+            return -1;
+        }
+    }
+
+    if (pi_future_status_get(&result) != 7 || pi_evt_status_get(&signal) != 7)
+    {
+        printf("Wrong when_all status\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+static int test_when_any()
+{
+    pi_future_t futures[2], result;
+    pi_future_t *list[2] = { &futures[0], &futures[1] };
+    pi_evt_t signal, end;
+
+    op_start(&ops[0], pi_future_init(&futures[0]), 3, 10000);
+    op_start(&ops[1], pi_future_init(&futures[1]), 4, 100);
+
+    pi_future_when_any(&result, list, 2);
+    pi_future_then(&result, pi_evt_sig_init(&signal));
+    pi_evt_sig_wait(&signal);
+
+    if (pi_future_status_get(&result) != 4 || pi_future_done(&futures[0]))
+    {
+        printf("Wrong when_any completion\n");
+        return -1;
+    }
+
+    // Let the slow operation complete before its future goes out of scope
+    pi_future_then(&futures[0], pi_evt_sig_init(&end));
+    pi_evt_sig_wait(&end);
+
+    return 0;
+}
+
+int main()
+{
+    printf("Entered example\n");
+
+    if (test_then()) return -1;
+    if (test_when_all()) return -1;
+    if (test_when_any()) return -1;
+
+    printf("Test success\n");
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/pool.h>
+#include <pmsis/kernel/time.h>
+
+#define NB_EVENTS 2
+
+static pi_evt_t events[NB_EVENTS];
+static pi_pool_t pool;
+static pi_evt_t end;
+static int count;
+
+static void handler(pi_evt_t *event)
+{
+    if (++count == NB_EVENTS)
+    {
+        pi_evt_notify(&end);
+    }
+}
+
+// Allocate all the events of the pool and check that it is then empty
+static int alloc_all(pi_evt_t **allocated)
+{
+    for (int i=0; i<NB_EVENTS; i++)
+    {
+        allocated[i] = pi_evt_alloc(&pool, handler);
+        if (allocated[i] == NULL)
+        {
+            printf("Allocation %d failed\n", i);
+            return -1;
+        }
+    }
+
+    if (pi_evt_alloc(&pool, handler) != NULL)
+    {
+        printf("Allocation should fail on empty pool\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    pi_evt_t *allocated[NB_EVENTS];
+
+    printf("Entered example\n");
+
+    pi_pool_init(&pool, events, sizeof(pi_evt_t), NB_EVENTS);
+
+    if (alloc_all(allocated)) return -1;
+
+    // The events are given back to the pool after their callback, here executed from the timer
+    // interrupt handler
+    pi_evt_sig_init(&end);
+    for (int i=0; i<NB_EVENTS; i++)
+    {
+        pi_evt_notify_delayed(allocated[i], 100 * (i + 1));
+    }
+    pi_evt_sig_wait(&end);
+
+    if (alloc_all(allocated)) return -1;
+
+    // Events which are not notified are explicitly freed
+    for (int i=0; i<NB_EVENTS; i++)
+    {
+        pi_evt_free(allocated[i]);
+    }
+
+    if (alloc_all(allocated)) return -1;
+
+    printf("Test success\n");
+
+    return 0;
+}
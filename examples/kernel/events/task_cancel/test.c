@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/time.h>
+
+static int count;
+
+static void task_handler(pi_evt_t *event)
+{
+    count++;
+}
+
+// Execute all pending tasks of the main thread, which is done while waiting for an event
+static void tasks_flush()
+{
+    pi_evt_t event;
+    pi_evt_notify(pi_evt_sig_init(&event));
+    pi_evt_sig_wait(&event);
+}
+
+static int check_count(const char *name, int expected)
+{
+    if (count != expected)
+    {
+        printf("%s: task executed %d times instead of %d\n", name, count, expected);
+        return -1;
+    }
+    count = 0;
+    return 0;
+}
+
+int main()
+{
+    pi_evt_t task;
+
+    printf("Entered example\n");
+
+    pi_evt_task_init(&task, task_handler, NULL);
+
+    // Notifying twice a pending task executes it once
+    pi_evt_notify(&task);
+    pi_evt_notify(&task);
+    tasks_flush();
+    if (check_count("double notify", 1)) return -1;
+
+    // The task is armed again after execution and can be notified without being initialized
+    pi_evt_notify(&task);
+    tasks_flush();
+    if (check_count("notify after execution", 1)) return -1;
+
+    // Cancelled before it reaches the task queue
+    pi_evt_notify(&task);
+    pi_evt_task_cancel(&task);
+    tasks_flush();
+    if (check_count("cancel", 0)) return -1;
+
+    // Cancelled once in the task queue, where it is pushed by the timer interrupt while we are
+    // not waiting
+    pi_evt_notify_delayed(&task, 100);
+    uint64_t end = pi_time_get_us() + 1000;
+    while (pi_time_get_us() < end);
+    pi_evt_task_cancel(&task);
+    tasks_flush();
+    if (check_count("cancel from queue", 0)) return -1;
+
+    // Notified again after being cancelled, before being dropped
+    pi_evt_notify(&task);
+    pi_evt_task_cancel(&task);
+    pi_evt_notify(&task);
+    tasks_flush();
+    if (check_count("notify after cancel", 1)) return -1;
+
+    // Dropped tasks can be notified again
+    pi_evt_notify(&task);
+    tasks_flush();
+    if (check_count("notify after drop", 1)) return -1;
+
+    printf("Test success\n");
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/time.h>
+
+#define PERIOD     1000
+#define NB_PERIODS 10
+
+static void busy_wait(uint32_t us)
+{
+    uint64_t end = pi_time_get_us() + us;
+    while (pi_time_get_us() < end);
+}
+
+int main()
+{
+    pi_thread_t *thread = pi_thread_get_current();
+
+    printf("Entered example\n");
+
+    if (pi_thread_wait_next_period() != -1)
+    {
+        printf("Waiting without period did not fail\n");
+        return -1;
+    }
+
+    pi_thread_period_set(PERIOD);
+    uint64_t start = pi_time_get_us();
+
+    // Releases are absolute, the time spent in each period must not delay the next ones
+    for (int i=0; i<NB_PERIODS; i++)
+    {
+        busy_wait(PERIOD / 2);
+        if (pi_thread_wait_next_period() != 0)
+        {
+            printf("Unexpected overrun at period %d\n", i);
+            return -1;
+        }
+    }
+
+    uint64_t elapsed = pi_time_get_us() - start;
+    if (elapsed < NB_PERIODS*PERIOD || elapsed >= NB_PERIODS*PERIOD + PERIOD / 2)
+    {
+        printf("Periods are drifting (elapsed: %d us)\n", (int)elapsed);
+        return -1;
+    }
+
+    // Running for more than two periods must skip the two releases which have passed
+    busy_wait(PERIOD * 5 / 2);
+    int missed = pi_thread_wait_next_period();
+    if (missed != 2 || pi_thread_period_overruns_get(thread) != 2)
+    {
+        printf("Wrong overruns (missed: %d, total: %d)\n", missed,
+            pi_thread_period_overruns_get(thread));
+        return -1;
+    }
+
+    // Every release must be accounted in the jitter histogram
+    uint32_t *jitter = pi_thread_period_jitter_get(thread);
+    uint32_t nb_releases = 0;
+    for (int i=0; i<PI_THREAD_JITTER_NB_BUCKETS; i++)
+    {
+        nb_releases += jitter[i];
+    }
+
+    if (nb_releases != NB_PERIODS + 1)
+    {
+        printf("Wrong number of releases in jitter histogram (%d)\n", (int)nb_releases);
+        return -1;
+    }
+
+    printf("Test success\n");
+
+    return 0;
+}
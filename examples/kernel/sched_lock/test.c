@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/time.h>
+
+#define STACK_SIZE 2048
+#define DELAY      1000
+
+static uint8_t stack[STACK_SIZE];
+static volatile int woken_up;
+
+static void thread_entry(void *arg)
+{
+    pi_evt_t event;
+
+    // Become ready again from the timer interrupt, while the main thread holds the scheduler lock
+    pi_evt_notify_delayed(pi_evt_sig_init(&event), DELAY);
+    pi_evt_sig_wait(&event);
+
+    woken_up = 1;
+}
+
+int main()
+{
+    pi_thread_t thread;
+    pi_evt_t event;
+
+    printf("Entered example, creating thread\n");
+
+    // Higher priority than the main thread, it immediately runs until it waits for its delay
+    if (pi_thread_create(&thread, "thread", thread_entry, NULL, 1, stack,
+            STACK_SIZE, pi_evt_sig_init(&event))) return -1;
+
+    pi_sched_lock();
+
+    // The thread becomes ready during this loop but must not preempt us
+    uint64_t end = pi_time_get_us() + 2*DELAY;
+    while (pi_time_get_us() < end);
+
+    if (woken_up)
+    {
+        printf("Thread switch was not deferred\n");
+        return -1;
+    }
+
+    pi_sched_unlock();
+
+    // The deferred switch must be done by the unlock
+    if (!woken_up)
+    {
+        printf("Thread switch was not done at unlock\n");
+        return -1;
+    }
+
+    pi_evt_sig_wait(&event);
+
+    printf("Test success\n");
+
+    return 0;
+}
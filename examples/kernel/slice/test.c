@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/time.h>
+
+#define STACK_SIZE 1024
+// Slice tick, given by kernel.threading.slice
+#define SLICE_TICK 1000
+// Both threads are spinning for this duration
+#define DURATION   (40*SLICE_TICK)
+// Time between two iterations of a thread above which we consider it was preempted
+#define GAP        (SLICE_TICK / 4)
+
+static uint8_t stacks[2][STACK_SIZE];
+static pi_thread_t threads[2];
+static pi_evt_t start_events[2];
+static pi_evt_t end_events[2];
+static uint64_t end;
+static uint32_t run_time[2];
+
+static void thread_entry(void *arg)
+{
+    int id = (int)arg;
+
+    pi_evt_sig_wait(&start_events[id]);
+
+    // Accumulate the time we are running, which is given by our slice since both threads are
+    // always ready
+    uint64_t prev = pi_time_get_us(), now;
+    while ((now = pi_time_get_us()) < end)
+    {
+        if (now - prev < GAP)
+        {
+            run_time[id] += now - prev;
+        }
+        prev = now;
+    }
+}
+
+int main()
+{
+    printf("Entered example\n");
+
+    if (pi_thread_priority_slice_set(PI_THREAD_MAX_PRIORITIES, SLICE_TICK) != -1)
+    {
+        printf("Out of range priority was accepted\n");
+        return -1;
+    }
+
+    // The first thread runs 3 times longer than the second one, which takes the slice of its
+    // priority
+    pi_thread_priority_slice_set(1, 2*SLICE_TICK);
+
+    for (int i=0; i<2; i++)
+    {
+        pi_evt_sig_init(&start_events[i]);
+        if (pi_thread_create(&threads[i], "thread", thread_entry, (void *)i, 1, stacks[i],
+                STACK_SIZE, pi_evt_sig_init(&end_events[i]))) return -1;
+    }
+
+    pi_thread_slice_set(&threads[0], 6*SLICE_TICK);
+
+    end = pi_time_get_us() + DURATION;
+
+    int irq = pi_irq_lock();
+    pi_evt_notify_unsafe(&start_events[0]);
+    pi_evt_notify_unsafe(&start_events[1]);
+    pi_irq_unlock(irq);
+
+    pi_evt_sig_wait(&end_events[0]);
+    pi_evt_sig_wait(&end_events[1]);
+
+    // Allow some margin for the slices cut by the start and the end of the test
+    if (run_time[1] == 0 || run_time[0] < 2*run_time[1] || run_time[0] > 4*run_time[1])
+    {
+        printf("Slices are not respected (run time: %d us / %d us)\n", (int)run_time[0],
+            (int)run_time[1]);
+        return -1;
+    }
+
+    printf("Test success\n");
+
+    return 0;
+}
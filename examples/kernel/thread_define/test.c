@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/thread.h>
+#include <pmsis/kernel/time.h>
+
+#define STACK_SIZE 1024
+#define TIMEOUT    10000
+
+static volatile int high_arg;
+static volatile int low_arg;
+
+static void high_entry(void *arg)
+{
+    high_arg = (int)arg;
+}
+
+static void low_entry(void *arg)
+{
+    low_arg = (int)arg;
+}
+
+// Both threads are ready before main is entered, the first one with a higher priority and the
+// second one with the same priority as main
+PI_THREAD_DEFINE(high_thread, high_entry, (void *)1, 1, STACK_SIZE);
+PI_THREAD_DEFINE(low_thread, low_entry, (void *)2, 0, STACK_SIZE);
+
+int main()
+{
+    printf("Entered example\n");
+
+    // The higher priority thread must run as soon as the scheduler gets control, while the other
+    // one must share the core with main
+    uint64_t end = pi_time_get_us() + TIMEOUT;
+    while ((!high_arg || !low_arg) && pi_time_get_us() < end)
+    {
+        pi_thread_yield();
+    }
+
+    if (high_arg != 1 || low_arg != 2)
+    {
+        printf("Static threads did not run (high: %d, low: %d)\n", high_arg, low_arg);
+        return -1;
+    }
+
+    printf("Test success\n");
+
+    return 0;
+}
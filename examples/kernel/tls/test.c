@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pmsis/kernel/thread.h>
+
+#define STACK_SIZE 1024
+#define NB_THREADS 2
+#define NB_YIELDS  4
+
+// One instance initialized from .tdata and one from .tbss in each thread
+static __thread int tls_data = 0x1234;
+static __thread int tls_bss;
+
+static uint8_t stacks[NB_THREADS][STACK_SIZE];
+static pi_thread_t threads[NB_THREADS];
+static pi_evt_t end_events[NB_THREADS];
+static volatile int errors;
+
+// Set the per-thread values and check they are kept while the other threads modify theirs
+static void tls_check(int id)
+{
+    if (tls_data != 0x1234 || tls_bss != 0)
+    {
+        printf("Wrong initial TLS values in thread %d (data: 0x%x, bss: %d)\n", id, tls_data,
+            tls_bss);
+        errors++;
+    }
+
+    tls_data = id;
+    tls_bss = id * 10;
+    errno = id + 1;
+
+    for (int i=0; i<NB_YIELDS; i++)
+    {
+        pi_thread_yield();
+
+        if (tls_data != id || tls_bss != id * 10 || errno != id + 1)
+        {
+            printf("TLS values of thread %d were modified (data: %d, bss: %d, errno: %d)\n", id,
+                tls_data, tls_bss, errno);
+            errors++;
+            return;
+        }
+    }
+}
+
+static void thread_entry(void *arg)
+{
+    tls_check((int)arg);
+}
+
+int main()
+{
+    printf("Entered example\n");
+
+    // Same priority as main so that the threads are interleaved by pi_thread_yield
+    for (int i=0; i<NB_THREADS; i++)
+    {
+        if (pi_thread_create(&threads[i], "thread", thread_entry, (void *)(i + 1), 0, stacks[i],
+                STACK_SIZE, pi_evt_sig_init(&end_events[i]))) return -1;
+    }
+
+    tls_check(0);
+
+    for (int i=0; i<NB_THREADS; i++)
+    {
+        pi_evt_sig_wait(&end_events[i]);
+    }
+
+    if (errors)
+    {
+        return -1;
+    }
+
+    printf("Test success\n");
+
+    return 0;
+}
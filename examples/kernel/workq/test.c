@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pmsis/kernel/workq.h>
+#include <pmsis/kernel/time.h>
+
+#define STACK_SIZE 1024
+#define NB_WORKERS 2
+#define HOLD_TIME  1000
+#define EXEC_TIME  500
+
+// Workers keep waiting for tasks once a test is over, their structures must stay valid
+static uint8_t stacks[NB_WORKERS][STACK_SIZE];
+static pi_workq_worker_t workers[NB_WORKERS];
+static pi_workq_t workq;
+static uint8_t single_stack[STACK_SIZE];
+static pi_workq_worker_t single_worker;
+static pi_workq_t single_workq;
+
+static pi_evt_t blocker_started, blocker_release, end;
+static int order[PI_WORKQ_NB_PRIORITIES];
+static int nb_executed;
+static volatile int nb_running, max_running;
+
+// Keep a worker busy until released
+static void blocker_entry(pi_workq_task_t *task)
+{
+    pi_evt_notify(&blocker_started);
+    pi_evt_sig_wait(&blocker_release);
+}
+
+static void order_entry(pi_workq_task_t *task)
+{
+    order[nb_executed++] = (int)pi_workq_task_arg(task);
+    if (nb_executed == PI_WORKQ_NB_PRIORITIES)
+    {
+        pi_evt_notify(&end);
+    }
+}
+
+// Wait for some time so that several of these tasks are running at the same time
+static void parallel_entry(pi_workq_task_t *task)
+{
+    pi_evt_t event;
+
+    if (++nb_running > max_running)
+    {
+        max_running = nb_running;
+    }
+
+    pi_evt_notify_delayed(pi_evt_sig_init(&event), HOLD_TIME);
+    pi_evt_sig_wait(&event);
+
+    nb_running--;
+    if (++nb_executed == NB_WORKERS)
+    {
+        pi_evt_notify(&end);
+    }
+}
+
+static void busy_entry(pi_workq_task_t *task)
+{
+    uint64_t end_time = pi_time_get_us() + EXEC_TIME;
+    while (pi_time_get_us() < end_time);
+    pi_evt_notify(&end);
+}
+
+// With only one worker, check that queued tasks are executed by priority
+static int test_priorities()
+{
+    pi_workq_task_t blocker, tasks[PI_WORKQ_NB_PRIORITIES];
+    pi_evt_t drained;
+
+    if (pi_workq_create(&single_workq, &single_worker, 1, 1, single_stack, STACK_SIZE)) return -1;
+
+    if (pi_workq_task_init(&blocker, &single_workq, blocker_entry, NULL,
+            PI_WORKQ_NB_PRIORITIES) != NULL)
+    {
+        printf("Out of range priority was accepted\n");
+        return -1;
+    }
+
+    nb_executed = 0;
+    pi_evt_sig_init(&end);
+    pi_evt_sig_init(&blocker_started);
+    pi_evt_sig_init(&blocker_release);
+    pi_evt_notify(pi_workq_task_init(&blocker, &single_workq, blocker_entry, NULL, 0));
+    pi_evt_sig_wait(&blocker_started);
+
+    // Push from the lowest priority, the ready list being executed in reverse order, the drained
+    // signal is notified once all the tasks are pushed
+    pi_evt_notify(pi_evt_sig_init(&drained));
+    for (int i=0; i<PI_WORKQ_NB_PRIORITIES; i++)
+    {
+        pi_evt_notify(pi_workq_task_init(&tasks[i], &single_workq, order_entry, (void *)i, i));
+    }
+    pi_evt_sig_wait(&drained);
+
+    pi_evt_t hold;
+    pi_evt_notify_delayed(pi_evt_sig_init(&hold), HOLD_TIME);
+    pi_evt_sig_wait(&hold);
+
+    pi_evt_notify(&blocker_release);
+    pi_evt_sig_wait(&end);
+
+    for (int i=0; i<PI_WORKQ_NB_PRIORITIES; i++)
+    {
+        if (order[i] != PI_WORKQ_NB_PRIORITIES - 1 - i)
+        {
+            printf("Wrong task order (index %d, priority %d)\n", i, order[i]);
+            return -1;
+        }
+    }
+
+    // The last task waited for the blocker to be released
+    if (pi_workq_task_latency_get(&tasks[0]) < HOLD_TIME)
+    {
+        printf("Wrong task latency\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+// With several workers, check that tasks are executed in parallel and that the execution time
+// is measured
+static int test_workers()
+{
+    pi_workq_task_t tasks[NB_WORKERS], busy;
+
+    if (pi_workq_create(&workq, workers, NB_WORKERS, 1, stacks, STACK_SIZE)) return -1;
+
+    nb_executed = 0;
+    pi_evt_sig_init(&end);
+    for (int i=0; i<NB_WORKERS; i++)
+    {
+        pi_evt_notify(pi_workq_task_init(&tasks[i], &workq, parallel_entry, NULL, 0));
+    }
+    pi_evt_sig_wait(&end);
+
+    if (max_running != NB_WORKERS)
+    {
+        printf("Tasks were not executed in parallel\n");
+        return -1;
+    }
+
+    pi_evt_sig_init(&end);
+    pi_evt_notify(pi_workq_task_init(&busy, &workq, busy_entry, NULL, 0));
+    pi_evt_sig_wait(&end);
+
+    // The end is notified by the task, wait for the worker to measure its execution time
+    pi_evt_t wait;
+    pi_evt_notify_delayed(pi_evt_sig_init(&wait), HOLD_TIME);
+    pi_evt_sig_wait(&wait);
+
+    if (pi_workq_task_exec_time_get(&busy) < EXEC_TIME)
+    {
+        printf("Wrong task execution time\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    printf("Entered example\n");
+
+    if (test_priorities()) return -1;
+    if (test_workers()) return -1;
+
+    printf("Test success\n");
+
+    return 0;
+}
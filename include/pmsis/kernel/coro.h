@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/kernel.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/time.h>
+
+/**
+ * @addtogroup coro_apis
+ * @{
+ */
+
+/**
+ * @brief Coroutine type.
+ *
+ * Stackless coroutine, executed as a sequence of tasks on a thread work queue.
+ */
+typedef struct pi_coro_s pi_coro_t;
+
+/**
+ * @brief Start a coroutine.
+ *
+ * The coroutine body is a function which is executed as a task on the work queue of the given
+ * thread. Each time the body waits for an asynchronous operation, it returns, and it is executed
+ * again as a task once the operation is done, continuing from where it stopped.
+ *
+ * The body must be delimited with PI_CORO_BEGIN() and PI_CORO_END(). Since the coroutine does not
+ * have any stack, local variables are lost each time it waits, any state which must be kept must
+ * be stored in a structure, for example embedding the coroutine, or given through the argument.
+ *
+ * @param coro Pointer to the coroutine structure to initialize.
+ * @param entry Coroutine body.
+ * @param arg Argument which can be retrieved from the body with pi_coro_arg().
+ * @param thread Thread executing the coroutine, or NULL for the main thread.
+ * @param end Optional event notified when the coroutine reaches PI_CORO_END() (can be NULL).
+ */
+void pi_coro_start(pi_coro_t *coro, void (*entry)(pi_coro_t *), void *arg, pi_thread_t *thread,
+    pi_evt_t *end);
+
+/**
+ * @brief Get the argument of a coroutine.
+ *
+ * @param coro Pointer to the coroutine.
+ *
+ * @return The argument given to pi_coro_start().
+ */
+ALWAYS_INLINE void *pi_coro_arg(pi_coro_t *coro);
+
+/**
+ * @brief Get the event of a coroutine.
+ *
+ * This is the event which must be given to the asynchronous operation started by
+ * PI_CORO_AWAIT(), and which resumes the coroutine when it is notified. Once the coroutine is
+ * resumed, it gives the status of the operation through pi_evt_status_get().
+ *
+ * @param coro Pointer to the coroutine.
+ *
+ * @return The event of the coroutine.
+ */
+ALWAYS_INLINE pi_evt_t *pi_coro_evt(pi_coro_t *coro);
+
+/**
+ * @brief Start the body of a coroutine.
+ *
+ * @param coro Pointer to the coroutine.
+ */
+#define PI_CORO_BEGIN(coro) \
+    switch (__pi_coro_state(coro)) { case 0:
+
+/**
+ * @brief Wait for an asynchronous operation from a coroutine.
+ *
+ * The statement start is executed to start the operation, which must notify the event returned
+ * by pi_coro_evt() when it is done. The coroutine then returns and continues after this macro once
+ * the event is notified.
+ *
+ * This can only be used once per source line.
+ *
+ * @param coro Pointer to the coroutine.
+ * @param start Statement starting the asynchronous operation.
+ */
+#define PI_CORO_AWAIT(coro, start) \
+    do { __pi_coro_suspend((coro), __LINE__); start; return; case __LINE__:; } while (0)
+
+/**
+ * @brief Wait for a delay from a coroutine.
+ *
+ * @param coro Pointer to the coroutine.
+ * @param delay Delay in micro-seconds.
+ */
+#define PI_CORO_DELAY(coro, delay) \
+    PI_CORO_AWAIT(coro, pi_evt_notify_delayed(pi_coro_evt(coro), (delay)))
+
+/**
+ * @brief Let the other tasks of the thread execute before continuing the coroutine.
+ *
+ * @param coro Pointer to the coroutine.
+ */
+#define PI_CORO_YIELD(coro) \
+    PI_CORO_AWAIT(coro, pi_evt_notify(pi_coro_evt(coro)))
+
+/**
+ * @brief End the body of a coroutine.
+ *
+ * This terminates the coroutine and notifies its end event.
+ *
+ * @param coro Pointer to the coroutine.
+ */
+#define PI_CORO_END(coro) \
+    } __pi_coro_end(coro); return
+
+/**
+ * @}
+ */
+
+#include <kernel/coro_data.h>
+#include <kernel/coro_implem.h>
@@ -82,6 +82,10 @@ ALWAYS_INLINE pi_evt_t *pi_evt_cb_init(pi_evt_t *event, void (*callback)(pi_evt_
  * @param callback Function that will be called when the event is scheduled on the work queue.
  * @param thread Pointer to the thread on whose work queue the task will be scheduled.
  *
+ * @note Once initialized, the task can be notified again as soon as it has started execution, or
+ * has been cancelled, without being initialized again. It must not be initialized again while it
+ * is pending or cancelled.
+ *
  * @return Pointer to the event.
  *
  */
@@ -101,7 +105,9 @@ ALWAYS_INLINE pi_evt_t *pi_evt_task_init(pi_evt_t *event, void (*callback)(pi_ev
  * if it is from an interrupt handler.
  *
  * In the case of a task event, it is pushed to its work queue and will be executed later
- * when it is scheduled.
+ * when it is scheduled. Notifying a task which is already pending does nothing, and notifying a
+ * cancelled task which has not been dropped yet makes it pending again, at its previous position
+ * in the work queue.
  *
  * @param event Pointer to the event.
  *
@@ -125,6 +131,28 @@ ALWAYS_INLINE void pi_evt_notify(pi_evt_t *event);
  */
 ALWAYS_INLINE void pi_evt_notify_unsafe(pi_evt_t *event);
 
+/**
+ * @brief Cancel a pending task event.
+ *
+ * The task is flagged as cancelled in constant time and is left in its work queue, where it is
+ * dropped without being executed once it is popped. If the task is not pending, nothing is done.
+ * The task can be notified again right after it has been cancelled.
+ *
+ * @param event Pointer to the task event.
+ */
+ALWAYS_INLINE void pi_evt_task_cancel(pi_evt_t *event);
+
+/**
+ * @brief Cancel a pending task event without internal locking.
+ *
+ * This behaves exactly as pi_evt_task_cancel() but does not perform any internal locking.
+ * This function must be called from a context where interrupts are already disabled or from
+ * an interrupt handler.
+ *
+ * @param event Pointer to the task event.
+ */
+ALWAYS_INLINE void pi_evt_task_cancel_unsafe(pi_evt_t *event);
+
 /**
  * @brief Wait for the completion of a signal event.
  *
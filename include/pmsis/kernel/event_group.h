@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <stdint.h>
+#include <pmsis/kernel/kernel.h>
+#include <pmsis/kernel/event.h>
+
+/**
+ * @addtogroup event_group_apis
+ * @{
+ */
+
+/**
+ * @brief Event group type.
+ *
+ * An event group is a 32-bit word of flags, which can be set for example by interrupt handlers,
+ * and on which threads can wait for a combination of flags.
+ */
+typedef struct pi_evt_group_s pi_evt_group_t;
+
+/**
+ * @brief Wait for all the flags of the mask instead of any of them.
+ */
+#define PI_EVT_GROUP_WAIT_ALL  (1<<0)
+
+/**
+ * @brief Clear the flags of the mask once the wait is satisfied.
+ */
+#define PI_EVT_GROUP_CLEAR     (1<<1)
+
+/**
+ * @brief Initialize an event group.
+ *
+ * All flags are cleared.
+ *
+ * @param group Pointer to the event group.
+ */
+ALWAYS_INLINE void pi_evt_group_init(pi_evt_group_t *group);
+
+/**
+ * @brief Set flags of an event group.
+ *
+ * The flags are ORed into the group, and the callers waiting for flags which are now satisfied
+ * are woken up, as if their signal event was notified.
+ *
+ * @param group Pointer to the event group.
+ * @param flags Flags to set.
+ */
+ALWAYS_INLINE void pi_evt_group_set(pi_evt_group_t *group, uint32_t flags);
+
+/**
+ * @brief Set flags of an event group without internal locking.
+ *
+ * This behaves exactly as pi_evt_group_set() but does not perform any internal locking.
+ * This function must be called from a context where interrupts are already disabled or from
+ * an interrupt handler.
+ *
+ * @param group Pointer to the event group.
+ * @param flags Flags to set.
+ */
+void pi_evt_group_set_unsafe(pi_evt_group_t *group, uint32_t flags);
+
+/**
+ * @brief Clear flags of an event group.
+ *
+ * @param group Pointer to the event group.
+ * @param flags Flags to clear.
+ */
+ALWAYS_INLINE void pi_evt_group_clear(pi_evt_group_t *group, uint32_t flags);
+
+/**
+ * @brief Get the flags of an event group.
+ *
+ * @param group Pointer to the event group.
+ *
+ * @return The flags currently set.
+ */
+ALWAYS_INLINE uint32_t pi_evt_group_get(pi_evt_group_t *group);
+
+/**
+ * @brief Wait for flags of an event group.
+ *
+ * This blocks the caller until any of the flags of the mask is set, or all of them if
+ * PI_EVT_GROUP_WAIT_ALL is given. If the wait is already satisfied, this returns immediately.
+ * As for signal events, the caller executes the tasks of its thread while it is blocked.
+ *
+ * If PI_EVT_GROUP_CLEAR is given, the flags of the mask are cleared when the wait is satisfied,
+ * so that they are consumed by this caller only.
+ *
+ * @param group Pointer to the event group.
+ * @param mask Flags to wait for.
+ * @param options Combination of PI_EVT_GROUP_WAIT_ALL and PI_EVT_GROUP_CLEAR, or 0.
+ *
+ * @return The flags of the group when the wait was satisfied, before they are cleared.
+ */
+uint32_t pi_evt_group_wait(pi_evt_group_t *group, uint32_t mask, int options);
+
+/**
+ * @}
+ */
+
+#include <kernel/event_group_data.h>
+#include <kernel/event_group_implem.h>
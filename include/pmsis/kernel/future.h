@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/kernel.h>
+#include <pmsis/kernel/event.h>
+
+/**
+ * @addtogroup future_apis
+ * @{
+ */
+
+/**
+ * @brief Future type.
+ *
+ * A future represents the result of an asynchronous operation, to which continuations can be
+ * chained.
+ */
+typedef struct pi_future_s pi_future_t;
+
+/**
+ * @brief Initialize a future.
+ *
+ * This returns the event which must be given to the asynchronous operation. When the operation
+ * notifies it, the future is completed with the event status, and its continuation is
+ * executed.
+ *
+ * @param future Pointer to the future.
+ *
+ * @return The event to give to the asynchronous operation.
+ */
+ALWAYS_INLINE pi_evt_t *pi_future_init(pi_future_t *future);
+
+/**
+ * @brief Chain a continuation to a future.
+ *
+ * The continuation is an event of any kind. When the future completes, the continuation
+ * status is set to the future status and the continuation is directly triggered, from the context
+ * completing the future: a callback event has its callback called, a task event is pushed to its
+ * thread work queue, and a signal event wakes up its waiting thread. There is no intermediate
+ * event notification, which saves one notification at each stage of a pipeline.
+ *
+ * If the future is already completed, the continuation is notified immediately, as with
+ * pi_evt_notify(), so that it is not executed by the caller.
+ *
+ * @param future Pointer to the future.
+ * @param continuation Event triggered when the future completes.
+ */
+void pi_future_then(pi_future_t *future, pi_evt_t *continuation);
+
+/**
+ * @brief Combine futures into a future completed when all of them are completed.
+ *
+ * The status of the result is 0 if all the futures completed with status 0, otherwise the first
+ * non-zero status. The futures must not be part of another combination.
+ *
+ * @param result Pointer to the resulting future.
+ * @param futures Array of futures to combine.
+ * @param nb_futures Number of futures in the array.
+ */
+void pi_future_when_all(pi_future_t *result, pi_future_t **futures, int nb_futures);
+
+/**
+ * @brief Combine futures into a future completed when any of them is completed.
+ *
+ * The status of the result is the status of the first completed future. The futures must not be
+ * part of another combination.
+ *
+ * @param result Pointer to the resulting future.
+ * @param futures Array of futures to combine.
+ * @param nb_futures Number of futures in the array.
+ */
+void pi_future_when_any(pi_future_t *result, pi_future_t **futures, int nb_futures);
+
+/**
+ * @brief Tell if a future is completed.
+ *
+ * @param future Pointer to the future.
+ *
+ * @return 1 if the future is completed, 0 otherwise.
+ */
+ALWAYS_INLINE int pi_future_done(pi_future_t *future);
+
+/**
+ * @brief Get the status of a future.
+ *
+ * @param future Pointer to the future.
+ *
+ * @return The status of the operation which completed the future.
+ */
+ALWAYS_INLINE int pi_future_status_get(pi_future_t *future);
+
+/**
+ * @}
+ */
+
+#include <kernel/future_data.h>
+#include <kernel/future_implem.h>
@@ -37,6 +37,34 @@ static inline int pi_irq_lock();
  */
 static inline void pi_irq_unlock(int state);
 
+#if defined(CONFIG_IRQ_LEVEL_LOCK)
+/**
+ * @brief Disable interrupts up to a priority level.
+ *
+ * This function disables all interrupts whose priority is lower or equal to the given level,
+ * while the other ones can still be received. This can be used to enter a critical section
+ * protecting data which is only accessed by interrupt routines up to this level, without
+ * delaying the interrupts with a higher priority.
+ *
+ * Interrupt routines executed during the critical section do not execute event callbacks nor
+ * schedule threads, this is done once the critical section is left. No blocking function must
+ * be called inside the critical section.
+ *
+ * This is only available when the irq.level_lock or irq.nested build parameter is enabled.
+ *
+ * @param level     Highest priority level to be disabled.
+ * @return          State to be given to pi_irq_unlock_level().
+ */
+static inline int pi_irq_lock_level(int level);
+
+/**
+ * @brief Restore interrupts state after a level critical section.
+ *
+ * @param state     State returned by pi_irq_lock_level().
+ */
+static inline void pi_irq_unlock_level(int state);
+#endif
+
 /**
  * @brief Enable an interrupt.
  *
@@ -68,6 +96,40 @@ static inline void pi_irq_disable(int irq);
  */
 void pi_irq_handler_set(int irq, void (*handler)(void *), void *arg);
 
+/**
+ * @brief Set interrupt priority.
+ *
+ * This function sets the priority of an interrupt, which is used by pi_irq_lock_level() and,
+ * when nested interrupts are enabled with the irq.nested build parameter, to know which
+ * interrupts can preempt an interrupt routine. The handler of an interrupt, as well as the
+ * event callbacks executed when leaving interrupt handlers, can then be preempted by any
+ * interrupt with a higher priority. All interrupts have priority 0 by default, which means
+ * they are never nested.
+ *
+ * Handlers of interrupts with a priority higher than 0 can interrupt other handlers and event
+ * callbacks. They must only notify events with pi_evt_notify_unsafe() and can not call other
+ * unsafe functions.
+ *
+ * This does not apply when the core was sleeping while waiting for an event. Since nothing is
+ * saved in this case, the handler and the callbacks it triggers are executed with interrupts
+ * disabled and higher priority interrupts are only taken once they are done.
+ *
+ * @param irq            Interrupt number.
+ * @param priority       Interrupt priority, from 0 to PI_IRQ_NB_PRIORITIES - 1, the highest
+ *                       value is the highest priority.
+ * @return               0 if the priority was set, -1 if it is out of range.
+ */
+int pi_irq_priority_set(int irq, int priority);
+
+/**
+ * @brief Request kernel checks from a fast interrupt routine.
+ *
+ * This function can be called from an handler set with pi_irq_handler_set_fast() to have the
+ * kernel execute the pending event callbacks and reschedule threads right after the handler
+ * returns, as it does after a normal interrupt routine.
+ */
+static inline void pi_irq_fast_handler_check();
+
 /**
  * @brief Clear an interrupt status flag.
  *
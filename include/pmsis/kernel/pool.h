@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/kernel.h>
+#include <pmsis/kernel/event.h>
+
+/**
+ * @addtogroup pool_apis
+ * @{
+ */
+
+/**
+ * @brief Pool type.
+ *
+ * A pool manages an array of fixed-size blocks, which can be allocated and freed in constant
+ * time, including from interrupt handlers.
+ */
+typedef struct pi_pool_s pi_pool_t;
+
+/**
+ * @brief Initialize a pool.
+ *
+ * All the blocks of the array are free after initialization. The array is owned by the pool
+ * until it is not used anymore.
+ *
+ * @param pool Pointer to the pool.
+ * @param blocks Array of blocks, aligned on a pointer.
+ * @param block_size Size in bytes of each block. It must be a multiple of the pointer size and
+ * at least the pointer size.
+ * @param nb_blocks Number of blocks in the array.
+ */
+void pi_pool_init(pi_pool_t *pool, void *blocks, unsigned int block_size, int nb_blocks);
+
+/**
+ * @brief Allocate a block from a pool.
+ *
+ * @param pool Pointer to the pool.
+ *
+ * @return Pointer to the block, or NULL if all blocks are allocated.
+ */
+ALWAYS_INLINE void *pi_pool_alloc(pi_pool_t *pool);
+
+/**
+ * @brief Allocate a block from a pool without internal locking.
+ *
+ * This behaves exactly as pi_pool_alloc() but does not perform any internal locking.
+ * This function must be called from a context where interrupts are already disabled or from
+ * an interrupt handler.
+ *
+ * @param pool Pointer to the pool.
+ *
+ * @return Pointer to the block, or NULL if all blocks are allocated.
+ */
+ALWAYS_INLINE void *pi_pool_alloc_unsafe(pi_pool_t *pool);
+
+/**
+ * @brief Free a block to its pool.
+ *
+ * @param pool Pointer to the pool.
+ * @param block Pointer to the block, which must have been allocated from this pool.
+ */
+ALWAYS_INLINE void pi_pool_free(pi_pool_t *pool, void *block);
+
+/**
+ * @brief Free a block to its pool without internal locking.
+ *
+ * This behaves exactly as pi_pool_free() but does not perform any internal locking.
+ * This function must be called from a context where interrupts are already disabled or from
+ * an interrupt handler.
+ *
+ * @param pool Pointer to the pool.
+ * @param block Pointer to the block, which must have been allocated from this pool.
+ */
+ALWAYS_INLINE void pi_pool_free_unsafe(pi_pool_t *pool, void *block);
+
+/**
+ * @brief Allocate a callback event from a pool.
+ *
+ * The event is allocated from a pool of blocks of size sizeof(pi_evt_t), and is initialized as
+ * a callback event. Once its callback has been executed, the event is automatically freed to its
+ * pool, so that fire-and-forget notifications, like a delayed callback from an interrupt handler,
+ * do not need to manage the event memory. This can be called from interrupt handlers.
+ *
+ * @param pool Pointer to the pool of events.
+ * @param callback Function that will be called when the event is notified.
+ *
+ * @return Pointer to the event, or NULL if the pool is empty.
+ */
+ALWAYS_INLINE pi_evt_t *pi_evt_alloc(pi_pool_t *pool, void (*callback)(pi_evt_t*));
+
+/**
+ * @brief Free an event allocated from a pool.
+ *
+ * This is only needed for events which will not be notified anymore, since events are freed
+ * automatically after their callback.
+ *
+ * @param event Pointer to the event, which must have been allocated with pi_evt_alloc().
+ */
+ALWAYS_INLINE void pi_evt_free(pi_evt_t *event);
+
+/**
+ * @}
+ */
+
+#include <kernel/pool_data.h>
+#include <kernel/pool_implem.h>
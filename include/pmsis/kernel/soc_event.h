@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/event.h>
+
+
+/**
+ * @addtogroup soc_event_apis
+ * @{
+ */
+
+/**
+ * @brief Set SoC event handler.
+ *
+ * SoC events are generated by peripherals, for example by uDMA channels, and are all pushed to
+ * the same FIFO in the interrupt controller, which raises a single interrupt. The kernel pops
+ * all the pending events from the FIFO in one interrupt and calls the handler attached to each
+ * event ID.
+ *
+ * The handler is called from interrupt context and must be fast.
+ *
+ * @param event          SoC event ID.
+ * @param handler        Handler to execute, or NULL to detach the current one.
+ * @param arg            Argument given to the handler.
+ */
+void pi_soc_event_handler_set(int event, void (*handler)(void *), void *arg);
+
+/**
+ * @brief Attach an event to a SoC event.
+ *
+ * This behaves as pi_soc_event_handler_set(), except that the given event is notified with
+ * pi_evt_notify_unsafe() each time the SoC event is received, instead of calling a handler.
+ *
+ * The event must be initialized again before the SoC event is received again.
+ *
+ * @param event          SoC event ID.
+ * @param evt            Event to be notified.
+ */
+void pi_soc_event_evt_set(int event, pi_evt_t *evt);
+
+/**
+ * @}
+ */
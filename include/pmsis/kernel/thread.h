@@ -41,6 +41,161 @@ typedef struct pi_thread_s pi_thread_t;
 int pi_thread_create(pi_thread_t *thread, const char *name, void (*entry)(void *), void *arg,
     int priority, void *stack, unsigned int stack_size, pi_evt_t *event);
 
+/**
+ * @brief Declare a thread at build time.
+ *
+ * This declares a global thread with the given name and its stack. The thread is fully
+ * initialized at build time and starts during the system initialization, as if it was created
+ * with pi_thread_create() before main() is called, but without any code executed to initialize
+ * it.
+ *
+ * Threads and stacks are placed in dedicated sections so that the total amount of memory used
+ * by the stacks is reported when the application is linked.
+ *
+ * The thread can be referenced from other files with `extern pi_thread_t name;`.
+ *
+ * @param name Name of the thread variable.
+ * @param entry Entry point function for the thread.
+ * @param arg Argument to pass to the entry function.
+ * @param prio Priority level of the thread (higher values = higher priority).
+ * @param stack_size Size of the stack in bytes.
+ */
+#define PI_THREAD_DEFINE(name, entry, arg, prio, stack_size) \
+    static char __pi_thread_stack_##name[stack_size] \
+        __attribute__((section(".bss.__pi_thread_stacks"), aligned(16))); \
+    pi_thread_t name __attribute__((section(".data.__pi_threads"), used)) = \
+        __PI_THREAD_STATIC_INIT(entry, arg, prio, __pi_thread_stack_##name, stack_size)
+
+#if defined(CONFIG_THREAD_EDF)
+/**
+ * @brief Set the deadline of a thread.
+ *
+ * This is only available when the deadline scheduling class is enabled. Threads created with the
+ * priority of this class are scheduled by earliest deadline first instead of round-robin, and
+ * are not time-sliced. Any other priority level keeps its fixed-priority behavior.
+ *
+ * Until its deadline is set, a thread of this class is considered due at its creation time.
+ *
+ * @param thread Pointer to the thread.
+ * @param deadline Absolute deadline in microseconds, as returned by pi_time_get_us(). Since
+ *   deadlines are compared on 32 bits, they must be less than about 35 minutes ahead.
+ */
+void pi_thread_deadline_set(pi_thread_t *thread, uint32_t deadline);
+#endif
+
+#if defined(CONFIG_THREAD_PERIODIC)
+/**
+ * @brief Make the current thread periodic.
+ *
+ * This is only available when periodic threads are enabled. The first release time of the
+ * current thread is set to the current time, and each call to pi_thread_wait_next_period() will
+ * then wait until the next release, computed from the previous one so that the period does not
+ * drift with the execution time of the thread. This also resets the overrun counter and the
+ * jitter histogram of the thread.
+ *
+ * @param period Period in microseconds.
+ */
+void pi_thread_period_set(uint32_t period);
+
+/**
+ * @brief Wait for the next release of the current periodic thread.
+ *
+ * Blocks the current thread until its next absolute release time. If this release time has
+ * already passed, the thread overran its period and the missed releases are skipped, so that the
+ * thread waits for the first release in the future.
+ *
+ * The difference between the release time and the time the thread is actually woken up is
+ * recorded in the jitter histogram of the thread.
+ *
+ * When deadline scheduling is enabled, the deadline of the thread is also set to the end of the
+ * period starting at this release.
+ *
+ * @return Number of releases missed since the previous call, 0 if the thread did not overrun,
+ * or -1 if the period of the thread was not set.
+ */
+int pi_thread_wait_next_period();
+
+/**
+ * @brief Get the number of overruns of a periodic thread.
+ *
+ * @param thread Pointer to the thread structure.
+ *
+ * @return Total number of releases missed by the thread since its period was set.
+ */
+ALWAYS_INLINE int pi_thread_period_overruns_get(pi_thread_t *thread);
+
+/**
+ * @brief Get the release jitter histogram of a periodic thread.
+ *
+ * The histogram has PI_THREAD_JITTER_NB_BUCKETS buckets. Each bucket counts the releases whose
+ * jitter is within a range of PI_THREAD_JITTER_STEP microseconds, and the last one gathers
+ * everything above.
+ *
+ * @param thread Pointer to the thread structure.
+ *
+ * @return The array of buckets.
+ */
+ALWAYS_INLINE uint32_t *pi_thread_period_jitter_get(pi_thread_t *thread);
+#endif
+
+#if defined(CONFIG_THREAD_PREEMPTION)
+/**
+ * @brief Set the time slice of a thread.
+ *
+ * This is only available when preemption is enabled. When several threads of the same priority
+ * are ready, the running one is only preempted in favor of the next one once it has run for its
+ * slice. This overrides the slice of the priority level of the thread.
+ *
+ * The slice is rounded up to a multiple of the slice tick, given by *kernel.threading.slice*.
+ * If the thread is the running one, its new slice starts immediately.
+ *
+ * @param thread Pointer to the thread structure.
+ * @param slice Slice in microseconds, or 0 to use again the slice of the thread priority.
+ */
+void pi_thread_slice_set(pi_thread_t *thread, uint32_t slice);
+
+/**
+ * @brief Set the time slice of a priority level.
+ *
+ * This is only available when preemption is enabled. This gives the slice of all the threads of
+ * the specified priority which do not have their own slice. By default, it is one slice tick.
+ *
+ * The slice is rounded up to a multiple of the slice tick, given by *kernel.threading.slice*.
+ *
+ * @param priority Priority level, from 0 to PI_THREAD_MAX_PRIORITIES - 1.
+ * @param slice Slice in microseconds.
+ *
+ * @return 0 if the slice was set, -1 if the priority is out of range.
+ */
+int pi_thread_priority_slice_set(int priority, uint32_t slice);
+#endif
+
+#if defined(CONFIG_THREAD_SCHED_LOCK)
+/**
+ * @brief Lock the scheduler.
+ *
+ * This is only available when the scheduler lock is enabled. Until pi_sched_unlock() is called,
+ * the current thread can not be preempted by another thread, while interrupt handlers and event
+ * callbacks keep executing. This is cheaper than disabling interrupts for code which only needs
+ * to be protected from other threads, and does not increase interrupt latency.
+ *
+ * Any thread switch requested by an interrupt handler while the scheduler is locked, because a
+ * thread became ready or the time slice is over, is deferred until the scheduler is unlocked.
+ *
+ * Calls can be nested, the scheduler is unlocked by the last call to pi_sched_unlock(). The
+ * thread must not block while the scheduler is locked.
+ */
+ALWAYS_INLINE void pi_sched_lock();
+
+/**
+ * @brief Unlock the scheduler.
+ *
+ * This ends the section started by pi_sched_lock(). If this is the outermost one, any thread
+ * switch which was deferred during the section is done now.
+ */
+ALWAYS_INLINE void pi_sched_unlock();
+#endif
+
 /**
  * @brief Set the status of the current thread.
  *
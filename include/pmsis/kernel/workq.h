@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <stdint.h>
+#include <pmsis/kernel/kernel.h>
+#include <pmsis/kernel/event.h>
+#include <pmsis/kernel/thread.h>
+
+/**
+ * @addtogroup workq_apis
+ * @{
+ */
+
+/**
+ * @brief Work-queue type.
+ *
+ * A work-queue owns several worker threads sharing a priority-ordered task queue.
+ */
+typedef struct pi_workq_s pi_workq_t;
+
+/**
+ * @brief Work-queue worker type.
+ *
+ * Holds the state of one worker thread of a work-queue.
+ */
+typedef struct pi_workq_worker_s pi_workq_worker_t;
+
+/**
+ * @brief Work-queue task type.
+ */
+typedef struct pi_workq_task_s pi_workq_task_t;
+
+/**
+ * @brief Create a work-queue.
+ *
+ * This creates one thread per worker. Each worker executes the highest priority task of the
+ * queue, and waits when the queue is empty. Since idle workers pull tasks from the shared queue,
+ * a long task on one worker does not delay the other tasks as long as another worker is idle.
+ *
+ * @param workq Pointer to the work-queue structure to initialize.
+ * @param workers Array of worker structures, one per worker.
+ * @param nb_workers Number of workers.
+ * @param priority Priority of the worker threads.
+ * @param stacks Stacks of the worker threads, one after the other.
+ * @param stack_size Size in bytes of the stack of each worker thread.
+ *
+ * @return 0 on success, negative error code on failure.
+ */
+int pi_workq_create(pi_workq_t *workq, pi_workq_worker_t *workers, int nb_workers, int priority,
+    void *stacks, unsigned int stack_size);
+
+/**
+ * @brief Initialize a work-queue task.
+ *
+ * This returns an event which, once notified, pushes the task to the work-queue. It can be given
+ * to any asynchronous operation, or notified directly with pi_evt_notify(). Tasks with higher
+ * priority are executed first, and tasks with the same priority are executed in order.
+ *
+ * The task can be notified again once its execution has started, without being initialized
+ * again. It must not be notified while it is still queued, which would corrupt the queue, and it
+ * must not be released before its execution is over.
+ *
+ * @param task Pointer to the task.
+ * @param workq Work-queue executing the task.
+ * @param callback Function executed by a worker.
+ * @param arg Argument which can be retrieved from the callback with pi_workq_task_arg().
+ * @param priority Task priority, from 0 to PI_WORKQ_NB_PRIORITIES - 1 (higher values = higher
+ *   priority).
+ *
+ * @return The event pushing the task when it is notified, or NULL if the priority is out of
+ *   range.
+ */
+pi_evt_t *pi_workq_task_init(pi_workq_task_t *task, pi_workq_t *workq,
+    void (*callback)(pi_workq_task_t *), void *arg, int priority);
+
+/**
+ * @brief Get the argument of a work-queue task.
+ *
+ * @param task Pointer to the task.
+ *
+ * @return The argument given to pi_workq_task_init().
+ */
+ALWAYS_INLINE void *pi_workq_task_arg(pi_workq_task_t *task);
+
+/**
+ * @brief Get the latency of a work-queue task.
+ *
+ * @param task Pointer to the task.
+ *
+ * @return Time in microseconds between the task push and the beginning of its execution.
+ */
+ALWAYS_INLINE uint32_t pi_workq_task_latency_get(pi_workq_task_t *task);
+
+/**
+ * @brief Get the execution time of a work-queue task.
+ *
+ * This is only valid once the execution of the task is over.
+ *
+ * @param task Pointer to the task.
+ *
+ * @return Execution time of the task callback in microseconds.
+ */
+ALWAYS_INLINE uint32_t pi_workq_task_exec_time_get(pi_workq_task_t *task);
+
+/**
+ * @}
+ */
+
+#include <kernel/workq_data.h>
+#include <kernel/workq_implem.h>
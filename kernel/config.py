@@ -24,6 +24,32 @@ def declare(target, container: SourceContainer):
             container.add_define('CONFIG_THREAD_PREEMPTION', 1)
             container.add_define('CONFIG_THREAD_SLICE', slice)
 
+        edf = BuildParameter(container, 'kernel.threading.edf', False, 'Enable earliest deadline first scheduling for one priority level').value
+        if edf:
+            edf_priority = BuildParameter(container, 'kernel.threading.edf.priority', 1, 'Priority level whose threads are scheduled by deadline').value
+
+            container.add_define('CONFIG_THREAD_EDF', 1)
+            container.add_define('CONFIG_THREAD_EDF_PRIORITY', edf_priority)
+
+        sched_lock = BuildParameter(container, 'kernel.threading.sched_lock', False, 'Enable scheduler lock to disable thread preemption without disabling interrupts').value
+        if sched_lock:
+            container.add_define('CONFIG_THREAD_SCHED_LOCK', 1)
+
+        tls = BuildParameter(container, 'kernel.threading.tls', False, 'Enable thread-local storage').value
+        if tls:
+            container.add_define('CONFIG_THREAD_TLS', 1)
+            # The runtime is statically linked, TLS variables are directly accessed from tp
+            container.add_cflags('-ftls-model=local-exec')
+
+        periodic = BuildParameter(container, 'kernel.threading.periodic', False, 'Enable periodic threads').value
+        if periodic:
+            jitter_nb_buckets = BuildParameter(container, 'kernel.threading.periodic.jitter_nb_buckets', 8, 'Number of buckets of the periodic thread release jitter histogram').value
+            jitter_step = BuildParameter(container, 'kernel.threading.periodic.jitter_step', 10, 'Width in microseconds of each bucket of the release jitter histogram').value
+
+            container.add_define('CONFIG_THREAD_PERIODIC', 1)
+            container.add_define('CONFIG_THREAD_JITTER_NB_BUCKETS', jitter_nb_buckets)
+            container.add_define('CONFIG_THREAD_JITTER_STEP', jitter_step)
+
         container.add_define('CONFIG_THREAD', 1)
 
         container.add_sources([
@@ -35,11 +61,30 @@ def declare(target, container: SourceContainer):
     if event:
         container.add_define('CONFIG_EVENT', 1)
 
+        if threading:
+            event_thread = BuildParameter(container, 'kernel.event.thread', False, 'Execute event callbacks in a kernel thread instead of interrupt handlers').value
+            if event_thread:
+                budget = BuildParameter(container, 'kernel.event.thread.budget', 0, 'Maximum number of event callbacks executed when leaving an interrupt handler').value
+                stack_size = BuildParameter(container, 'kernel.event.thread.stack_size', 1024, 'Stack size of the event callbacks kernel thread').value
+
+                container.add_define('CONFIG_EVENT_THREAD', 1)
+                container.add_define('CONFIG_EVENT_THREAD_BUDGET', budget)
+                container.add_define('CONFIG_EVENT_THREAD_STACK_SIZE', stack_size)
+
         container.add_sources([
             'kernel/event.c',
             'kernel/event_asm.S',
+            'kernel/event_group.c',
+            'kernel/pool.c',
+            'kernel/coro.c',
+            'kernel/future.c',
         ])
 
+        if threading:
+            container.add_sources([
+                'kernel/workq.c',
+            ])
+
     container.add_sources([
         'kernel/init.c',
     ])
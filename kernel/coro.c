@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <pmsis/kernel/coro.h>
+
+void __pi_coro_resume(pi_evt_t *event)
+{
+    pi_coro_t *coro = (pi_coro_t *)event;
+    coro->entry(coro);
+}
+
+void __pi_coro_end(pi_coro_t *coro)
+{
+    if (coro->end)
+    {
+        pi_evt_notify(coro->end);
+    }
+}
+
+void pi_coro_start(pi_coro_t *coro, void (*entry)(pi_coro_t *), void *arg, pi_thread_t *thread,
+    pi_evt_t *end)
+{
+    coro->entry = entry;
+    coro->arg = arg;
+    coro->thread = thread;
+    coro->end = end;
+
+    // The body is executed for the first time as a task, as if it was resumed
+    coro->state = 0;
+    pi_evt_notify(pi_evt_task_init(&coro->event, __pi_coro_resume, thread));
+}
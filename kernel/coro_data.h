@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <kernel/event_data.h>
+
+typedef struct pi_coro_s
+{
+    // Task event used to resume the coroutine. Must be the first field as the task callback gets
+    // the coroutine from it.
+    pi_evt_t event;
+    // Coroutine body
+    void (*entry)(struct pi_coro_s *coro);
+    // Argument of the coroutine body
+    void *arg;
+    // Thread executing the coroutine tasks
+    pi_thread_t *thread;
+    // Event to be notified when the coroutine is finished
+    pi_evt_t *end;
+    // Source line where the coroutine must continue, 0 at the beginning
+    int state;
+} pi_coro_t;
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/event.h>
+
+// Task callback executing the coroutine body from where it stopped
+void __pi_coro_resume(pi_evt_t *event);
+// Terminate the coroutine and notify its end event
+void __pi_coro_end(pi_coro_t *coro);
+
+ALWAYS_INLINE void *pi_coro_arg(pi_coro_t *coro)
+{
+    return coro->arg;
+}
+
+ALWAYS_INLINE pi_evt_t *pi_coro_evt(pi_coro_t *coro)
+{
+    return &coro->event;
+}
+
+static inline int __pi_coro_state(pi_coro_t *coro)
+{
+    return coro->state;
+}
+
+// Record where the coroutine must continue. Its task event is armed again when the body starts
+// execution, so that it can be directly given to the next asynchronous operation.
+static inline void __pi_coro_suspend(pi_coro_t *coro, int state)
+{
+    coro->state = state;
+}
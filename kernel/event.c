@@ -5,10 +5,36 @@
 // Authors: Germain Haugou (germain.haugou@gmail.com)
 
 #include <pmsis/kernel/event.h>
+#if defined(CONFIG_THREAD)
+#include <pmsis/kernel/thread.h>
 #include <kernel/thread_implem.h>
+#endif
 
 PI_MEMORY_TINY pi_evt_t *__pi_evt_ready_first;
 
+#if !defined(CONFIG_THREAD)
+// Without threads, tasks are all queued to the same list and executed by the code waiting for an
+// event
+PI_MEMORY_TINY pi_evt_t *__pi_evt_task_first;
+PI_MEMORY_TINY pi_evt_t *__pi_evt_task_last;
+#if !defined(CONFIG_IRQ_SLEEP_INLINE)
+// Tell if the code waiting for an event is running or in the sleep loop
+PI_MEMORY_TINY int __pi_evt_running;
+#endif
+#endif
+
+#if defined(CONFIG_EVENT_THREAD)
+// Number of callbacks which can still be executed before leaving the current interrupt handler.
+// This is reset by the interrupt stubs each time they are entered.
+PI_MEMORY_TINY int __pi_evt_thread_budget;
+// Kernel thread executing the callbacks deferred by the interrupt handlers
+static pi_thread_t __pi_evt_thread;
+// Signal event used by the kernel thread to wait for new callbacks
+static pi_evt_t __pi_evt_thread_event;
+static char __pi_evt_thread_stack[CONFIG_EVENT_THREAD_STACK_SIZE];
+#endif
+
+#if defined(CONFIG_THREAD)
 // This gets called when a polling event gets notified to flag it and unblock any waiting thread.
 void __pi_evt_handle_signal(pi_evt_t *event)
 {
@@ -25,11 +51,9 @@ void __pi_evt_handle_signal(pi_evt_t *event)
     }
 }
 
-void __pi_evt_push_task(pi_evt_t *event)
+// Push a notified task to the associated thread task queue
+static void __pi_evt_task_enqueue(pi_evt_t *event)
 {
-    // We get called by the event callback attached to task events, when the event was notified.
-    // Now push the task to the associated thread task queue
-
     pi_thread_t *thread = event->thread;
 
     if (thread->first_task)
@@ -42,14 +66,137 @@ void __pi_evt_push_task(pi_evt_t *event)
     }
     thread->last_task = event;
     event->next = NULL;
-    event->callback = (void (*)(pi_evt_t*))event->waiting_thread;
 
     // The thread may need to become ready in case it is waiting for something
     __pi_thread_enqueue_ready_check(thread);
 }
 
+#else
+
+// Make the code waiting for an event leave the sleep loop, when called from an interrupt
+// handler
+static inline void __pi_evt_wakeup()
+{
+#if !defined(CONFIG_IRQ_SLEEP_INLINE)
+    if (!__pi_evt_running)
+    {
+        __pi_evt_running = 1;
+        asm volatile ("csrw %0, %1" :  : "I" (0x341), "r" (__pi_evt_sleep_wakeup) );
+    }
+#endif
+}
+
+void __pi_evt_handle_signal(pi_evt_t *event)
+{
+    event->callback = NULL;
+    // Whoever is waiting will check again its event
+    __pi_evt_wakeup();
+}
+
+static void __pi_evt_task_enqueue(pi_evt_t *event)
+{
+    if (__pi_evt_task_first)
+    {
+        __pi_evt_task_last->next = event;
+    }
+    else
+    {
+        __pi_evt_task_first = event;
+    }
+    __pi_evt_task_last = event;
+    event->next = NULL;
+
+    __pi_evt_wakeup();
+}
+
+#endif
+
+void __pi_evt_push_task(pi_evt_t *event)
+{
+    // We get called when the task is triggered directly instead of being notified, it is now
+    // pending
+    event->callback = __pi_evt_task_queued;
+    __pi_evt_task_enqueue(event);
+}
+
+void __pi_evt_task_queued(pi_evt_t *event)
+{
+    // The task was notified and now leaves the ready list for its task queue, where it keeps this
+    // callback until it is executed so that notifying it again does nothing
+    __pi_evt_task_enqueue(event);
+}
+
+void __pi_evt_task_cancelled(pi_evt_t *event)
+{
+    // The task was cancelled while in the ready list, just drop it. It is armed again so that it
+    // can still be notified
+    event->callback = __pi_evt_push_task;
+}
 
 void __pi_evt_sched_init()
 {
     __pi_evt_ready_first = NULL;
+#if !defined(CONFIG_THREAD)
+    __pi_evt_task_first = NULL;
+#if !defined(CONFIG_IRQ_SLEEP_INLINE)
+    __pi_evt_running = 1;
+#endif
+#endif
+}
+
+
+#if defined(CONFIG_EVENT_THREAD)
+static void __pi_evt_thread_entry(void *arg)
+{
+    int irq = pi_irq_lock();
+
+    while(1)
+    {
+        pi_evt_t *event = __pi_evt_ready_first;
+
+        if (event == NULL)
+        {
+            // Nothing to do, wait until an interrupt handler or a waiting thread wakes us up
+            pi_evt_sig_wait_unsafe(pi_evt_sig_init(&__pi_evt_thread_event));
+            continue;
+        }
+
+        __pi_evt_ready_first = event->next;
+
+        if (event->callback == __pi_evt_handle_signal || event->callback == __pi_evt_task_queued ||
+            event->callback == __pi_evt_task_cancelled)
+        {
+            // Kernel callbacks are short and update the scheduler, keep them atomic
+            event->callback(event);
+        }
+        else
+        {
+            // User callbacks can be long, execute them with interrupts enabled so that they do
+            // not delay interrupt handlers
+            pi_irq_unlock(irq);
+            event->callback(event);
+            irq = pi_irq_lock();
+        }
+    }
+}
+
+int __pi_evt_thread_wakeup()
+{
+    // The kernel thread may be waiting for callbacks, in which case the signal event is still
+    // pending, otherwise it is already going to check the callbacks
+    if (__pi_evt_thread_event.callback)
+    {
+        __pi_evt_handle_signal(&__pi_evt_thread_event);
+    }
+
+    // Tell the caller if it has to let the kernel thread execute
+    return __pi_thread_current != &__pi_evt_thread;
+}
+
+void __pi_evt_thread_init()
+{
+    pi_thread_create(&__pi_evt_thread, "evt", __pi_evt_thread_entry, NULL,
+        PI_THREAD_MAX_PRIORITIES - 1, __pi_evt_thread_stack, CONFIG_EVENT_THREAD_STACK_SIZE,
+        NULL);
 }
+#endif
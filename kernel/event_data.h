@@ -26,9 +26,9 @@ typedef struct pi_evt_s
     // List of threads waiting for the completion of the event in case it is a polling event.
     pi_thread_t *waiting_thread;
 
-    // Thread this event belongs to. This is not NULL only when the event is a work-item and has
-    // not been executed yet. In this case, it is set to NULL just before the work-item starts
-    // execution.
+    // Thread this event belongs to, when the event is a work-item. It is kept after execution so
+    // that the work-item can be notified again. For events allocated from a pool, this is the
+    // pool.
     pi_thread_t *thread;
 
     // Return value of the asynchromous operation associate to the event.
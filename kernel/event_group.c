@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <pmsis/kernel/event_group.h>
+
+// Check if the flags of the group satisfy a wait and consume them if asked. Returns the flags
+// seen by the wait, or 0 if it is not satisfied.
+static inline uint32_t __pi_evt_group_check(pi_evt_group_t *group, uint32_t mask, int options)
+{
+    uint32_t flags = group->flags;
+    uint32_t match = flags & mask;
+
+    if (match == 0 || ((options & PI_EVT_GROUP_WAIT_ALL) && match != mask))
+    {
+        return 0;
+    }
+
+    if (options & PI_EVT_GROUP_CLEAR)
+    {
+        group->flags = flags & ~mask;
+    }
+
+    return flags;
+}
+
+void pi_evt_group_set_unsafe(pi_evt_group_t *group, uint32_t flags)
+{
+#if defined(CONFIG_IRQ_NESTED)
+    // A higher priority interrupt handler may preempt us and update the same group
+    int irq = pi_irq_lock();
+#endif
+    group->flags |= flags;
+
+    pi_evt_group_waiter_t **prev = &group->waiters;
+    pi_evt_group_waiter_t *waiter = *prev;
+
+    while (waiter)
+    {
+        pi_evt_group_waiter_t *next = waiter->next;
+        uint32_t seen = __pi_evt_group_check(group, waiter->mask, waiter->options);
+
+        if (seen)
+        {
+            // Remove the waiter now so that the flags it cleared are not seen by the next ones,
+            // and wake it up through its signal event
+            *prev = next;
+            waiter->flags = seen;
+            pi_evt_notify_unsafe(&waiter->event);
+        }
+        else
+        {
+            prev = &waiter->next;
+        }
+
+        waiter = next;
+    }
+#if defined(CONFIG_IRQ_NESTED)
+    pi_irq_unlock(irq);
+#endif
+}
+
+uint32_t pi_evt_group_wait(pi_evt_group_t *group, uint32_t mask, int options)
+{
+    int irq = pi_irq_lock();
+
+    uint32_t flags = __pi_evt_group_check(group, mask, options);
+
+    if (flags == 0)
+    {
+        // Not satisfied yet, the waiter is on our stack since we stay blocked until it is
+        // removed from the group
+        pi_evt_group_waiter_t waiter;
+        waiter.mask = mask;
+        waiter.options = options;
+        waiter.next = group->waiters;
+        group->waiters = &waiter;
+
+        pi_evt_sig_wait_unsafe(pi_evt_sig_init(&waiter.event));
+
+        flags = waiter.flags;
+    }
+
+    pi_irq_unlock(irq);
+
+    return flags;
+}
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <stdint.h>
+#include <kernel/event_data.h>
+
+// Descriptor of a caller waiting on an event group, allocated on its stack
+typedef struct pi_evt_group_waiter_s
+{
+    // Signal event the caller is waiting on
+    pi_evt_t event;
+    // Next waiter of the group
+    struct pi_evt_group_waiter_s *next;
+    // Flags the caller is waiting for
+    uint32_t mask;
+    // Flags of the group when the wait was satisfied
+    uint32_t flags;
+    // Wait options
+    int options;
+} pi_evt_group_waiter_t;
+
+typedef struct pi_evt_group_s
+{
+    // Flags currently set
+    uint32_t flags;
+    // Callers waiting for flags
+    pi_evt_group_waiter_t *waiters;
+} pi_evt_group_t;
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/irq.h>
+
+ALWAYS_INLINE void pi_evt_group_init(pi_evt_group_t *group)
+{
+    group->flags = 0;
+    group->waiters = NULL;
+}
+
+ALWAYS_INLINE void pi_evt_group_set(pi_evt_group_t *group, uint32_t flags)
+{
+    int irq = pi_irq_lock();
+    pi_evt_group_set_unsafe(group, flags);
+    pi_irq_unlock(irq);
+}
+
+ALWAYS_INLINE void pi_evt_group_clear(pi_evt_group_t *group, uint32_t flags)
+{
+    int irq = pi_irq_lock();
+    group->flags &= ~flags;
+    pi_irq_unlock(irq);
+}
+
+ALWAYS_INLINE uint32_t pi_evt_group_get(pi_evt_group_t *group)
+{
+    return group->flags;
+}
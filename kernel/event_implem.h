@@ -10,6 +10,7 @@
 #include <pmsis/kernel/irq.h>
 #include <kernel/thread_data.h>
 
+#if defined(CONFIG_THREAD)
 // This is a kind of stub used to force the core to exits its sleep loop. This is force
 // in the MEPC csr during an interrupt handler to make it jump there, check work-items
 // and event wait status.
@@ -17,12 +18,34 @@ void __pi_thread_sleep_wakeup();
 // Block the execution until the event is signaled. This may execute events associated
 // to the current thread, and may also schedule another thread
 void __pi_evt_sig_wait(pi_evt_t *event, pi_thread_t *current_thread);
+#else
+// Same as for threads, for the sleep loop of the event-only runtime
+void __pi_evt_sleep_wakeup();
+// Block the execution until the event is signaled. This may execute any pending callback and
+// task
+void __pi_evt_sig_wait(pi_evt_t *event);
+#endif
 // Callback associated to signal events, which is in charge of handling signal events wakeup
 void __pi_evt_handle_signal(pi_evt_t *arg);
-// Event callback associated to task events, to make it push the task when the callback is execute.
+// Task events keep their state in their callback, while the task callback itself is kept in
+// waiting_thread. A task which is not pending has this callback, which pushes the task when it is
+// triggered directly.
 void __pi_evt_push_task(pi_evt_t *event);
+// Callback of pending tasks, executed when the task leaves the ready list to push it to its task
+// queue
+void __pi_evt_task_queued(pi_evt_t *event);
+// Callback of cancelled tasks which are still queued, they are dropped when they are popped
+void __pi_evt_task_cancelled(pi_evt_t *event);
 // Init scheduler, should be called during runtime init
 void __pi_evt_sched_init();
+#if defined(CONFIG_EVENT_THREAD)
+// Create the kernel thread executing event callbacks, should be called during runtime init once
+// the thread scheduler is ready
+void __pi_evt_thread_init();
+// Wake-up the kernel thread so that it executes pending callbacks. Returns 1 if the caller must
+// switch to it, 0 if the caller is the kernel thread.
+int __pi_evt_thread_wakeup();
+#endif
 
 ALWAYS_INLINE void pi_evt_sig_wait(pi_evt_t *event)
 {
@@ -35,14 +58,41 @@ ALWAYS_INLINE void pi_evt_sig_wait_unsafe(pi_evt_t *event)
 {
     if (event->callback)
     {
+#if defined(CONFIG_THREAD)
         __pi_evt_sig_wait(event, __pi_thread_current);
+#else
+        __pi_evt_sig_wait(event);
+#endif
     }
 }
 
 ALWAYS_INLINE void __attribute__((always_inline)) pi_evt_notify_unsafe(pi_evt_t *event)
 {
-    event->next = __pi_evt_ready_first;
-    __pi_evt_ready_first = event;
+#if defined(CONFIG_IRQ_NESTED)
+    // A higher priority interrupt handler may preempt us and notify another event
+    int irq = pi_irq_lock();
+#endif
+    void (*callback)(pi_evt_t *) = event->callback;
+
+    if (callback == __pi_evt_task_cancelled)
+    {
+        // Cancelled task which is still queued, it just has to be pending again
+        event->callback = __pi_evt_task_queued;
+    }
+    else if (callback != __pi_evt_task_queued)
+    {
+        if (callback == __pi_evt_push_task)
+        {
+            // Task which was not pending, it is from now on, so that notifying it again does
+            // nothing
+            event->callback = __pi_evt_task_queued;
+        }
+        event->next = __pi_evt_ready_first;
+        __pi_evt_ready_first = event;
+    }
+#if defined(CONFIG_IRQ_NESTED)
+    pi_irq_unlock(irq);
+#endif
 }
 
 ALWAYS_INLINE void __attribute__((always_inline)) pi_evt_notify(pi_evt_t *event)
@@ -68,11 +118,30 @@ ALWAYS_INLINE pi_evt_t *pi_evt_cb_init(pi_evt_t *event, void (*callback)(pi_evt_
 ALWAYS_INLINE pi_evt_t *pi_evt_task_init(pi_evt_t *event, void (*callback)(pi_evt_t*), pi_thread_t *thread)
 {
     pi_evt_cb_init(event, __pi_evt_push_task);
+#if defined(CONFIG_THREAD)
     event->thread = thread ? thread : &__pi_thread_main;
+#endif
     event->waiting_thread = (pi_thread_t *)callback;
     return event;
 }
 
+ALWAYS_INLINE void pi_evt_task_cancel_unsafe(pi_evt_t *event)
+{
+    // The task is left in its queue and just dropped when it is popped, so that it does not need
+    // to be searched
+    if (event->callback == __pi_evt_task_queued)
+    {
+        event->callback = __pi_evt_task_cancelled;
+    }
+}
+
+ALWAYS_INLINE void pi_evt_task_cancel(pi_evt_t *event)
+{
+    int irq = pi_irq_lock();
+    pi_evt_task_cancel_unsafe(event);
+    pi_irq_unlock(irq);
+}
+
 ALWAYS_INLINE int pi_evt_status_get(pi_evt_t *event)
 {
     return event->status;
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <pmsis/kernel/future.h>
+#include <pmsis/kernel/irq.h>
+
+// Directly execute the callback of the continuation, instead of notifying it, so that it is
+// executed from the context completing the future
+static void __pi_future_continuation_trigger(pi_future_t *future)
+{
+    pi_evt_t *continuation = future->continuation;
+    continuation->status = future->event.status;
+
+    void (*callback)(pi_evt_t *) = continuation->callback;
+    if (callback == __pi_evt_task_queued || callback == __pi_evt_task_cancelled)
+    {
+        // Task which is still queued, the notification takes care of its state so that it is not
+        // queued twice
+        pi_evt_notify_unsafe(continuation);
+    }
+    else
+    {
+        callback(continuation);
+    }
+}
+
+static void __pi_future_complete(pi_future_t *future);
+
+// Account a completed future in the combined future it is part of
+static void __pi_future_child_complete(pi_future_t *parent, pi_future_t *child)
+{
+    if (parent->done)
+    {
+        return;
+    }
+
+    if (parent->any)
+    {
+        parent->event.status = child->event.status;
+        __pi_future_complete(parent);
+    }
+    else
+    {
+        if (child->event.status && parent->event.status == 0)
+        {
+            parent->event.status = child->event.status;
+        }
+
+        if (--parent->pending == 0)
+        {
+            __pi_future_complete(parent);
+        }
+    }
+}
+
+static void __pi_future_complete(pi_future_t *future)
+{
+    future->done = 1;
+
+    if (future->parent)
+    {
+        __pi_future_child_complete(future->parent, future);
+    }
+
+    if (future->continuation)
+    {
+        __pi_future_continuation_trigger(future);
+    }
+}
+
+void __pi_future_handle(pi_evt_t *event)
+{
+    // This may be executed with interrupts enabled, for example by the kernel thread executing
+    // event callbacks, while completing the future updates the continuation thread queues
+    int irq = pi_irq_lock();
+    __pi_future_complete((pi_future_t *)event);
+    pi_irq_unlock(irq);
+}
+
+void pi_future_then(pi_future_t *future, pi_evt_t *continuation)
+{
+    int irq = pi_irq_lock();
+
+    future->continuation = continuation;
+    if (future->done)
+    {
+        // We are not in the context completing the future, the continuation is notified so that
+        // it is scheduled like any other event instead of being executed by the caller
+        continuation->status = future->event.status;
+        pi_evt_notify_unsafe(continuation);
+    }
+
+    pi_irq_unlock(irq);
+}
+
+static void __pi_future_combine(pi_future_t *result, pi_future_t **futures, int nb_futures,
+    int any)
+{
+    pi_future_init(result);
+    result->any = any;
+    result->pending = nb_futures;
+
+    int irq = pi_irq_lock();
+
+    for (int i=0; i<nb_futures; i++)
+    {
+        pi_future_t *future = futures[i];
+        future->parent = result;
+        // Futures which are already completed will not notify the result anymore
+        if (future->done)
+        {
+            __pi_future_child_complete(result, future);
+        }
+    }
+
+    // Nothing to wait for
+    if (!any && nb_futures == 0)
+    {
+        __pi_future_complete(result);
+    }
+
+    pi_irq_unlock(irq);
+}
+
+void pi_future_when_all(pi_future_t *result, pi_future_t **futures, int nb_futures)
+{
+    __pi_future_combine(result, futures, nb_futures, 0);
+}
+
+void pi_future_when_any(pi_future_t *result, pi_future_t **futures, int nb_futures)
+{
+    __pi_future_combine(result, futures, nb_futures, 1);
+}
@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <kernel/event_data.h>
+
+typedef struct pi_future_s
+{
+    // Event notified by the asynchronous operation. Must be the first field as its callback gets
+    // the future from it. Its status gives the future status.
+    pi_evt_t event;
+    // Event triggered when the future completes
+    pi_evt_t *continuation;
+    // Combined future this future is part of
+    struct pi_future_s *parent;
+    // For combined futures, number of futures which must still complete
+    int pending;
+    // True once the future is completed
+    char done;
+    // True if the combined future completes on the first completed future
+    char any;
+} pi_future_t;
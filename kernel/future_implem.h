@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <pmsis/kernel/event.h>
+
+// Callback of the future event, completing the future
+void __pi_future_handle(pi_evt_t *event);
+
+ALWAYS_INLINE pi_evt_t *pi_future_init(pi_future_t *future)
+{
+    future->continuation = NULL;
+    future->parent = NULL;
+    future->done = 0;
+    future->event.status = 0;
+    return pi_evt_cb_init(&future->event, __pi_future_handle);
+}
+
+ALWAYS_INLINE int pi_future_done(pi_future_t *future)
+{
+    return future->done;
+}
+
+ALWAYS_INLINE int pi_future_status_get(pi_future_t *future)
+{
+    return future->event.status;
+}
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <kernel/init.h>
 #ifdef CONFIG_IRQ
 #include <pmsis/kernel/irq.h>
@@ -77,6 +78,11 @@ void __pi_init_start()
     // BSS init
     __pi_init_bss();
 
+#if defined(CONFIG_THREAD_TLS)
+    // The TLS area of the main thread is in the BSS, only its initialized part must be copied
+    memcpy(__pi_linker_tls_main(), __pi_linker_tdata_start(), __pi_linker_tdata_size());
+#endif
+
 #ifdef CONFIG_LIBC
     // Early libc initialization to have printf ready as soon as possible.
     // This will make it available only for simple devices like semi-hosting, not for uart.
@@ -95,6 +101,10 @@ void __pi_init_start()
     __pi_thread_sched_init();
 #endif
 
+#ifdef CONFIG_EVENT_THREAD
+    __pi_evt_thread_init();
+#endif
+
     // Call global and static constructors
     // Each module may do private initializations there
     __pi_init_do_ctors();
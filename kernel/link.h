@@ -25,3 +25,65 @@ static inline uintptr_t __pi_init_bss_end()
 {
     return (uintptr_t)&_bss_end;
 }
+
+// These symbols should point to the first byte and the byte after the threads declared with
+// PI_THREAD_DEFINE
+extern unsigned char __pi_threads_start;
+extern unsigned char __pi_threads_end;
+
+// Return the first thread declared with PI_THREAD_DEFINE
+static inline void *__pi_linker_threads_start()
+{
+    return (void *)&__pi_threads_start;
+}
+
+// Return the address after the last thread declared with PI_THREAD_DEFINE
+static inline void *__pi_linker_threads_end()
+{
+    return (void *)&__pi_threads_end;
+}
+
+// These symbols give the initial image of the thread-local storage, made of the .tdata part,
+// followed by the .tbss part which must be zeroed
+extern unsigned char __pi_tdata_start;
+extern unsigned char __pi_tdata_end;
+extern unsigned char __pi_tbss_start;
+extern unsigned char __pi_tls_end;
+// TLS area reserved for the main thread
+extern unsigned char __pi_tls_main;
+
+// Return the initial image of the .tdata part of the thread-local storage
+static inline void *__pi_linker_tdata_start()
+{
+    return (void *)&__pi_tdata_start;
+}
+
+// Return the size of the .tdata part of the thread-local storage
+static inline uintptr_t __pi_linker_tdata_size()
+{
+    return (uintptr_t)&__pi_tdata_end - (uintptr_t)&__pi_tdata_start;
+}
+
+// Return the offset of the .tbss part in a thread-local storage area
+static inline uintptr_t __pi_linker_tbss_offset()
+{
+    return (uintptr_t)&__pi_tbss_start - (uintptr_t)&__pi_tdata_start;
+}
+
+// Return the size of the .tbss part of the thread-local storage
+static inline uintptr_t __pi_linker_tbss_size()
+{
+    return (uintptr_t)&__pi_tls_end - (uintptr_t)&__pi_tbss_start;
+}
+
+// Return the size of a thread-local storage area
+static inline uintptr_t __pi_linker_tls_size()
+{
+    return (uintptr_t)&__pi_tls_end - (uintptr_t)&__pi_tdata_start;
+}
+
+// Return the TLS area of the main thread
+static inline void *__pi_linker_tls_main()
+{
+    return (void *)&__pi_tls_main;
+}
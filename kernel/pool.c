@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <pmsis/kernel/pool.h>
+
+void pi_pool_init(pi_pool_t *pool, void *blocks, unsigned int block_size, int nb_blocks)
+{
+    pi_pool_block_t *next = NULL;
+
+    // Chain the blocks from the last one so that they are allocated in array order
+    for (int i=nb_blocks-1; i>=0; i--)
+    {
+        pi_pool_block_t *block = (pi_pool_block_t *)((char *)blocks + i*block_size);
+        block->next = next;
+        next = block;
+    }
+
+    pool->first = next;
+}
+
+void __pi_evt_pool_handle(pi_evt_t *event)
+{
+    void (*callback)(pi_evt_t *) = (void (*)(pi_evt_t*))event->waiting_thread;
+    callback(event);
+    pi_evt_free(event);
+}
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+// Free blocks are chained through their first word
+typedef struct pi_pool_block_s
+{
+    struct pi_pool_block_s *next;
+} pi_pool_block_t;
+
+typedef struct pi_pool_s
+{
+    // First free block
+    pi_pool_block_t *first;
+} pi_pool_t;
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <stddef.h>
+#include <pmsis/kernel/irq.h>
+
+// Callback of events allocated from a pool, executing the event callback, which is kept in
+// waiting_thread, and freeing the event to its pool, which is kept in thread
+void __pi_evt_pool_handle(pi_evt_t *event);
+
+ALWAYS_INLINE void *pi_pool_alloc_unsafe(pi_pool_t *pool)
+{
+    pi_pool_block_t *block = pool->first;
+    if (block)
+    {
+        pool->first = block->next;
+    }
+    return block;
+}
+
+ALWAYS_INLINE void *pi_pool_alloc(pi_pool_t *pool)
+{
+    int irq = pi_irq_lock();
+    void *block = pi_pool_alloc_unsafe(pool);
+    pi_irq_unlock(irq);
+    return block;
+}
+
+ALWAYS_INLINE void pi_pool_free_unsafe(pi_pool_t *pool, void *block)
+{
+    pi_pool_block_t *free_block = (pi_pool_block_t *)block;
+    free_block->next = pool->first;
+    pool->first = free_block;
+}
+
+ALWAYS_INLINE void pi_pool_free(pi_pool_t *pool, void *block)
+{
+    int irq = pi_irq_lock();
+    pi_pool_free_unsafe(pool, block);
+    pi_irq_unlock(irq);
+}
+
+ALWAYS_INLINE pi_evt_t *pi_evt_alloc(pi_pool_t *pool, void (*callback)(pi_evt_t*))
+{
+    pi_evt_t *event = (pi_evt_t *)pi_pool_alloc(pool);
+    if (event)
+    {
+        pi_evt_cb_init(event, __pi_evt_pool_handle);
+        event->waiting_thread = (pi_thread_t *)callback;
+        event->thread = (pi_thread_t *)pool;
+    }
+    return event;
+}
+
+ALWAYS_INLINE void pi_evt_free(pi_evt_t *event)
+{
+    pi_pool_free((pi_pool_t *)event->thread, event);
+}
@@ -7,6 +7,10 @@
 #include <string.h>
 #include <pmsis/kernel/thread.h>
 #include <kernel/hal.h>
+#include <kernel/link.h>
+#if defined(CONFIG_THREAD_EDF) || defined(CONFIG_THREAD_PERIODIC)
+#include <pmsis/kernel/time.h>
+#endif
 #if defined(__PLATFORM_GVSOC__)
 #if defined(__GVSOC_GUI__)
 #include <gvsoc.h>
@@ -32,6 +36,21 @@ PI_MEMORY_TINY char __pi_thread_force_resched;
 // Thread storage for main thread
 PI_MEMORY_TINY pi_thread_t __pi_thread_main;
 
+#if defined(CONFIG_THREAD_SCHED_LOCK)
+// Nesting level of pi_sched_lock calls. Interrupt handlers do not switch threads when not 0
+PI_MEMORY_TINY int __pi_thread_sched_locked;
+// Thread switches which have been deferred by interrupt handlers while the scheduler was locked
+PI_MEMORY_TINY char __pi_thread_sched_pending;
+#endif
+
+#if defined(CONFIG_THREAD_PREEMPTION)
+// Number of slice ticks left to the current thread before it is round-robined with the other
+// threads of the same priority
+PI_MEMORY_TINY int __pi_thread_slice_remaining;
+// Slice of each priority level, in number of slice ticks
+static int __pi_thread_priority_slices[PI_THREAD_MAX_PRIORITIES];
+#endif
+
 #if defined(__PLATFORM_GVSOC__)
 #if defined(__GVSOC_GUI__)
 // Store the VCD trace used to send to the profiler information about thread lifecycle
@@ -87,6 +106,65 @@ static inline void __attribute__((always_inline)) __pi_thread_enqueue(pi_thread_
     queue->last = thread;
 }
 
+#if defined(CONFIG_THREAD_EDF)
+// Insert a thread in a thread queue sorted by deadline. Threads with the same deadline are kept in
+// FIFO order.
+static void __pi_thread_enqueue_deadline(pi_thread_queue_t *queue, pi_thread_t *thread)
+{
+    pi_thread_t *prev = NULL;
+    pi_thread_t *current = queue->first;
+
+    while (current && !__pi_thread_deadline_before(thread->deadline, current->deadline))
+    {
+        prev = current;
+        current = current->next;
+    }
+
+    if (prev == NULL)
+    {
+        queue->first = thread;
+    }
+    else
+    {
+        prev->next = thread;
+    }
+
+    if (current == NULL)
+    {
+        queue->last = thread;
+    }
+
+    thread->next = current;
+}
+
+// Remove a thread from a thread queue
+static void __pi_thread_queue_remove(pi_thread_queue_t *queue, pi_thread_t *thread)
+{
+    pi_thread_t *prev = NULL;
+    pi_thread_t *current = queue->first;
+
+    while (current != thread)
+    {
+        prev = current;
+        current = current->next;
+    }
+
+    if (prev == NULL)
+    {
+        queue->first = thread->next;
+    }
+    else
+    {
+        prev->next = thread->next;
+    }
+
+    if (queue->last == thread)
+    {
+        queue->last = prev;
+    }
+}
+#endif
+
 // Initialize a thread state after creation so that it is ready to be scheduled
 static void __pi_thread_state_init(pi_thread_t *thread)
 {
@@ -95,7 +173,33 @@ static void __pi_thread_state_init(pi_thread_t *thread)
     thread->first_task = NULL;
     thread->ready = 0;
     thread->not_waiting = 1;
+#if defined(CONFIG_THREAD_PREEMPTION)
+    thread->slice = 0;
+#endif
+#if defined(CONFIG_THREAD_PERIODIC)
+    thread->period = 0;
+#endif
+}
+
+#if defined(CONFIG_THREAD_SCHED_LOCK)
+void __pi_thread_sched_pending_handle()
+{
+    // The global lock is used since a switch is done with it, the level lock state is not saved
+    // per thread
+    int irq = pi_irq_lock();
+    int pending = __pi_thread_sched_pending;
+    __pi_thread_sched_pending = 0;
+
+    // Same checks as the interrupt handlers, the current thread is running so it is ready
+    if (__pi_thread_ready &&
+        ((pending & PI_THREAD_SCHED_PENDING_FORCE) || __pi_thread_preempt_check()))
+    {
+        __pi_thread_switch_to_next();
+    }
+
+    pi_irq_unlock(irq);
 }
+#endif
 
 void pi_thread_yield()
 {
@@ -128,11 +232,33 @@ void pi_thread_exit()
     __pi_thread_deschedule();
 }
 
+#if defined(CONFIG_THREAD_TLS)
+// Initialize a TLS area of a thread from the initial image
+static void __pi_thread_tls_init(pi_thread_t *thread, void *tls)
+{
+    memcpy(tls, __pi_linker_tdata_start(), __pi_linker_tdata_size());
+    memset((char *)tls + __pi_linker_tbss_offset(), 0, __pi_linker_tbss_size());
+    thread->tp = (uint_t)tls;
+}
+
+// Reserve and initialize the TLS area of a thread at the top of its stack, and return the new
+// stack top
+static uint_t __pi_thread_tls_alloc(pi_thread_t *thread, uint_t stack_top)
+{
+    uint_t tls = (stack_top - __pi_linker_tls_size()) & ~15;
+    __pi_thread_tls_init(thread, (void *)tls);
+    return tls;
+}
+#endif
+
 // Init the thread saved context so that it can start executing after first context switch to it
 static void __pi_thread_init(pi_thread_t *thread, void (*entry)(void *), void *arg,
     int priority, void *stack, unsigned int stack_size, pi_evt_t *event)
 {
     thread->regs.sp = (long)stack + stack_size;
+#if defined(CONFIG_THREAD_TLS)
+    thread->regs.sp = __pi_thread_tls_alloc(thread, thread->regs.sp);
+#endif
     thread->regs.ra = (long)__pi_thread_start;
     thread->regs.s0 = (long)entry;
     thread->regs.s1 = (long)arg;
@@ -140,8 +266,58 @@ static void __pi_thread_init(pi_thread_t *thread, void (*entry)(void *), void *a
     thread->priority = priority;
     thread->event = event;
     thread->status = 0;
+#if defined(CONFIG_THREAD_EDF)
+    // Until it sets its own deadline, a thread of the deadline level is due immediately
+    thread->deadline = (uint_t)pi_time_get_us();
+#endif
 }
 
+#if defined(CONFIG_THREAD_PREEMPTION)
+// Convert a slice in microseconds into a number of slice ticks, which is at least 1
+static int __pi_thread_slice_ticks(uint32_t slice)
+{
+    int ticks = (slice + CONFIG_THREAD_SLICE - 1) / CONFIG_THREAD_SLICE;
+    return ticks == 0 ? 1 : ticks;
+}
+
+// Get the slice of a thread, in number of slice ticks
+static inline int __pi_thread_slice_get(pi_thread_t *thread)
+{
+    return thread->slice ? thread->slice : __pi_thread_priority_slices[(int)thread->priority];
+}
+
+void pi_thread_slice_set(pi_thread_t *thread, uint32_t slice)
+{
+    int irq = pi_irq_lock();
+    thread->slice = slice ? __pi_thread_slice_ticks(slice) : 0;
+    // The new slice of the running thread starts now, instead of once it is scheduled again
+    if (thread == __pi_thread_current)
+    {
+        __pi_thread_slice_remaining = __pi_thread_slice_get(thread);
+    }
+    pi_irq_unlock(irq);
+}
+
+int pi_thread_priority_slice_set(int priority, uint32_t slice)
+{
+    if (priority < 0 || priority >= PI_THREAD_MAX_PRIORITIES)
+    {
+        return -1;
+    }
+
+    int irq = pi_irq_lock();
+    __pi_thread_priority_slices[priority] = __pi_thread_slice_ticks(slice);
+    if (__pi_thread_current && __pi_thread_current->priority == priority &&
+        !__pi_thread_current->slice)
+    {
+        __pi_thread_slice_remaining = __pi_thread_priority_slices[priority];
+    }
+    pi_irq_unlock(irq);
+
+    return 0;
+}
+#endif
+
 // Init thread queue
 static void __pi_thread_queue_init(pi_thread_queue_t *queue)
 {
@@ -171,15 +347,53 @@ void __pi_thread_sched_init()
     __pi_thread_state_init(&__pi_thread_main);
     __pi_thread_main.ready = 1;
     __pi_thread_main.priority = 0;
+#if defined(CONFIG_THREAD_TLS)
+    // The TLS area of the main thread is already initialized and its thread pointer set at boot
+    __pi_thread_main.tp = (uint_t)__pi_linker_tls_main();
+#endif
+#if defined(CONFIG_THREAD_EDF)
+    __pi_thread_main.deadline = 0;
+#endif
     __pi_thread_current_running = 1;
     __pi_thread_resched = 0;
     __pi_thread_force_resched = 0;
+#if defined(CONFIG_THREAD_SCHED_LOCK)
+    __pi_thread_sched_locked = 0;
+    __pi_thread_sched_pending = 0;
+#endif
+
+#if defined(CONFIG_THREAD_PREEMPTION)
+    // By default, threads are round-robined at each slice tick
+    for (int i=0; i<PI_THREAD_MAX_PRIORITIES; i++)
+    {
+        __pi_thread_priority_slices[i] = 1;
+    }
+    __pi_thread_slice_remaining = 1;
+#endif
+
+    // Threads declared with PI_THREAD_DEFINE are already initialized, they just need to be ready
+    for (pi_thread_t *thread = __pi_linker_threads_start(); thread != __pi_linker_threads_end();
+        thread++)
+    {
+#if defined(__PLATFORM_GVSOC__)
+#if defined(__GVSOC_GUI__)
+        gv_vcd_dump_trace(__pi_thread_vcd_lifecycle, 1);
+        gv_vcd_dump_trace(__pi_thread_vcd_lifecycle, (uint32_t)thread);
+        __pi_thread_name_set(thread, NULL);
+#endif
+#endif
+#if defined(CONFIG_THREAD_TLS)
+        thread->regs.sp = __pi_thread_tls_alloc(thread, thread->regs.sp);
+#endif
+        __pi_thread_enqueue_ready(thread);
+    }
 }
 
 int pi_thread_create(pi_thread_t *thread, const char *name, void (*entry)(void *), void *arg, int priority,
     void *stack, unsigned int stack_size, pi_evt_t *event)
 {
-    int irq = pi_irq_lock();
+    // Thread queues are only accessed from priority 0 interrupt routines
+    int irq = __pi_irq_kernel_lock();
     __pi_thread_state_init(thread);
     __pi_thread_init(thread, entry, arg, priority, stack, stack_size, event);
     __pi_thread_enqueue_ready(thread);
@@ -192,7 +406,7 @@ int pi_thread_create(pi_thread_t *thread, const char *name, void (*entry)(void *
 #endif
 #endif
 
-    pi_irq_unlock(irq);
+    __pi_irq_kernel_unlock(irq);
 
     return 0;
 }
@@ -217,7 +431,17 @@ void __pi_thread_enqueue_ready(pi_thread_t *thread)
     int priority = thread->priority;
     thread->ready = 1;
     // Enqueue to the right priority
-    __pi_thread_enqueue(&__pi_thread_ready_queues[priority], thread);
+#if defined(CONFIG_THREAD_EDF)
+    // Threads of the deadline level are ordered by deadline instead of round-robin
+    if (priority == CONFIG_THREAD_EDF_PRIORITY)
+    {
+        __pi_thread_enqueue_deadline(&__pi_thread_ready_queues[priority], thread);
+    }
+    else
+#endif
+    {
+        __pi_thread_enqueue(&__pi_thread_ready_queues[priority], thread);
+    }
     // Update the priority mask so that the scheduler knows a thread is ready there
     __pi_thread_ready = __BITSET_R(__pi_thread_ready, 1, priority);
 }
@@ -227,6 +451,11 @@ void __pi_thread_switch_to_next()
     pi_thread_t *current = __pi_thread_current;
     __pi_thread_current = __pi_thread_dequeue_ready();
 
+#if defined(CONFIG_THREAD_PREEMPTION)
+    // The scheduled thread starts a full slice
+    __pi_thread_slice_remaining = __pi_thread_slice_get(__pi_thread_current);
+#endif
+
     // Only switch if next thread is different
     if (__pi_thread_current != current)
     {
@@ -239,16 +468,20 @@ void __pi_thread_switch_to_next()
         // If the current thread is currently blocked in the sleep loop, we have to make sure
         // it will go out of the loop the next time it is scheduled.
         // For that we modified the curent mepc since it will be saved by __pi_thread_switch
+#if !defined(CONFIG_IRQ_SLEEP_INLINE)
         if (!__pi_thread_current_running)
         {
             asm volatile ("csrw %0, %1" :  : "I" (0x341), "r" (__pi_thread_sleep_wakeup) );
         }
+#endif
 
         __pi_thread_current_running = 1;
 
+#if !defined(CONFIG_IRQ_SLEEP_INLINE)
         // We might have entered irq handler from fast mode. Since we're breaking
         // control flow, we need to switch back to normal mode.
         asm volatile ("csrw %0, %1" :  : "I" (CSR_MTVEC), "r" (__pi_linker_irq_vector_base()) );
+#endif
 
 #if defined(__PLATFORM_GVSOC__)
 #if defined(__GVSOC_GUI__)
@@ -273,14 +506,199 @@ void __pi_thread_deschedule()
     }
 }
 
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+void __pi_thread_sleep_inline()
+{
+    __pi_thread_current_running = 0;
+
+    do
+    {
+        __pi_irq_sleep_dispatch();
+
+        // Now do the same checks as the interrupt handler stubs, until there is nothing to do
+        while(1)
+        {
+            if (__pi_thread_resched)
+            {
+                __pi_thread_resched = 0;
+                if (__pi_thread_ready && (!__pi_thread_current->ready ||
+                    __pi_thread_preempt_check()))
+                {
+                    __pi_thread_switch_to_next();
+                }
+            }
+            else if (__pi_thread_force_resched)
+            {
+                __pi_thread_force_resched = 0;
+                __pi_thread_switch_to_next();
+            }
+#if defined(CONFIG_EVENT)
+            else if (__pi_evt_ready_first)
+            {
+#if defined(CONFIG_EVENT_THREAD)
+                // Callbacks are executed by the kernel thread, just check if we should switch
+                // to it
+                __pi_evt_thread_wakeup();
+                if (!__pi_thread_resched)
+                {
+                    break;
+                }
+#else
+                pi_evt_t *event = __pi_evt_ready_first;
+                __pi_evt_ready_first = event->next;
+                event->callback(event);
+#endif
+            }
+#endif
+            else
+            {
+                break;
+            }
+        }
+    }
+    while (!__pi_thread_current_running);
+}
+#endif
+
 void __pi_thread_slice_check()
 {
     // Check if a ready thread is higher priority than current thread.
     if (__pi_thread_ready)
     {
-        if (!__pi_thread_current || __pi_thread_current->priority <= __pi_thread_get_highest_prio())
+        int highest = __pi_thread_get_highest_prio();
+#if defined(CONFIG_THREAD_EDF)
+        // Threads of the deadline level are not time-sliced, the current one keeps running
+        // until a thread with an earlier deadline is ready
+        if (__pi_thread_current && highest == CONFIG_THREAD_EDF_PRIORITY &&
+            __pi_thread_current->priority == CONFIG_THREAD_EDF_PRIORITY)
+        {
+            if (__pi_thread_edf_preempt(highest))
+            {
+                __pi_thread_force_resched = 1;
+            }
+            return;
+        }
+#endif
+        if (!__pi_thread_current || __pi_thread_current->priority < highest)
         {
             __pi_thread_force_resched = 1;
         }
+        else if (__pi_thread_current->priority == highest)
+        {
+#if defined(CONFIG_THREAD_PREEMPTION)
+            // Threads of the same priority are only round-robined once the slice of the current
+            // one is over
+            if (--__pi_thread_slice_remaining <= 0)
+#endif
+            {
+                __pi_thread_force_resched = 1;
+            }
+        }
     }
 }
+
+#if defined(CONFIG_THREAD_EDF)
+void __pi_thread_edf_resched_check()
+{
+    if (__pi_thread_edf_preempt(CONFIG_THREAD_EDF_PRIORITY))
+    {
+        __pi_thread_force_resched = 0;
+        __pi_thread_switch_to_next();
+    }
+}
+
+void pi_thread_deadline_set(pi_thread_t *thread, uint32_t deadline)
+{
+    int irq = __pi_irq_kernel_lock();
+
+    thread->deadline = deadline;
+
+    if (thread->priority == CONFIG_THREAD_EDF_PRIORITY)
+    {
+        // A ready thread other than the current one is in the ready queue, where it must be
+        // moved to keep the queue sorted
+        if (thread->ready && thread != __pi_thread_current)
+        {
+            pi_thread_queue_t *queue = &__pi_thread_ready_queues[CONFIG_THREAD_EDF_PRIORITY];
+            __pi_thread_queue_remove(queue, thread);
+            __pi_thread_enqueue_deadline(queue, thread);
+        }
+    }
+
+    __pi_irq_kernel_unlock(irq);
+
+    // The new deadline may change which thread should run. The switch is done under the global
+    // lock since the level lock state is not saved per thread.
+    if (thread->priority == CONFIG_THREAD_EDF_PRIORITY)
+    {
+        irq = pi_irq_lock();
+        if (__pi_thread_ready && __pi_thread_preempt_check())
+        {
+            __pi_thread_switch_to_next();
+        }
+        pi_irq_unlock(irq);
+    }
+}
+#endif
+
+#if defined(CONFIG_THREAD_PERIODIC)
+void pi_thread_period_set(uint32_t period)
+{
+    pi_thread_t *thread = __pi_thread_current;
+
+    thread->period = period;
+    thread->release = (uint_t)pi_time_get_us();
+    thread->overruns = 0;
+    memset(thread->jitter, 0, sizeof(thread->jitter));
+}
+
+int pi_thread_wait_next_period()
+{
+    pi_thread_t *thread = __pi_thread_current;
+
+    // Without period, the next release could not be computed
+    if (thread->period == 0)
+    {
+        return -1;
+    }
+
+    uint_t release = thread->release + thread->period;
+    uint_t now = (uint_t)pi_time_get_us();
+    int missed = 0;
+
+    // Skip the releases which have already passed, so that an overrun does not trigger several
+    // activations in a row
+    while ((int)(now - release) > 0)
+    {
+        release += thread->period;
+        missed++;
+    }
+
+    thread->release = release;
+    thread->overruns += missed;
+
+#if defined(CONFIG_THREAD_EDF)
+    pi_thread_deadline_set(thread, release + thread->period);
+#endif
+
+    // Release times are absolute, the delay is only computed now to get a wake-up at the release
+    // time whatever the time spent by the thread since its last release
+    if (release != now)
+    {
+        pi_evt_t event;
+        pi_evt_notify_delayed(pi_evt_sig_init(&event), release - now);
+        pi_evt_sig_wait(&event);
+    }
+
+    // The timer event may fire slightly before the release time, which counts as no jitter
+    int jitter = (int)((uint_t)pi_time_get_us() - release);
+    uint_t bucket = jitter < 0 ? 0 : (uint_t)jitter / PI_THREAD_JITTER_STEP;
+    if (bucket >= PI_THREAD_JITTER_NB_BUCKETS)
+    {
+        bucket = PI_THREAD_JITTER_NB_BUCKETS - 1;
+    }
+    thread->jitter[bucket]++;
+
+    return missed;
+}
+#endif
@@ -14,6 +14,13 @@
 
 #define PI_THREAD_MAX_PRIORITIES 3
 
+#if defined(CONFIG_THREAD_PERIODIC)
+// Number of buckets of the release jitter histogram of periodic threads
+#define PI_THREAD_JITTER_NB_BUCKETS CONFIG_THREAD_JITTER_NB_BUCKETS
+// Width in microseconds of each bucket of the release jitter histogram
+#define PI_THREAD_JITTER_STEP CONFIG_THREAD_JITTER_STEP
+#endif
+
 typedef struct pi_thread_queue_s
 {
     struct pi_thread_s *first;
@@ -60,8 +67,46 @@ typedef struct pi_thread_s
     // False if threading is waiting for something (e.g. mutex or signal event).
     // This does not prevent him from beeing ready so that it can execute work-items.
     char not_waiting;
+#if defined(CONFIG_THREAD_TLS)
+    // Thread pointer, giving the thread-local storage area, loaded in tp when switching to the
+    // thread. Must stay the first optional field as it is accessed from assembly.
+    uint_t tp;
+#endif
+#if defined(CONFIG_THREAD_PREEMPTION)
+    // Slice of this thread in number of slice ticks, or 0 to use the slice of its priority
+    int slice;
+#endif
+#if defined(CONFIG_THREAD_EDF)
+    // Absolute deadline in microseconds, used to order the threads of the deadline priority level
+    uint_t deadline;
+#endif
+#if defined(CONFIG_THREAD_PERIODIC)
+    // Period in microseconds of a periodic thread
+    uint_t period;
+    // Absolute time in microseconds of the last release of a periodic thread
+    uint_t release;
+    // Number of releases missed by a periodic thread
+    int overruns;
+    // Histogram of the release jitter of a periodic thread
+    uint32_t jitter[CONFIG_THREAD_JITTER_NB_BUCKETS];
+#endif
 } pi_thread_t;
 
+// Initializer of the threads declared with PI_THREAD_DEFINE. This must give the same state as
+// pi_thread_create, except that the thread is not yet in the ready queue.
+#define __PI_THREAD_STATIC_INIT(_entry, _arg, _prio, _stack, _stack_size) \
+    { \
+        .regs = { \
+            .ra = (uint_t)__pi_thread_start, \
+            .s0 = (uint_t)(_entry), \
+            .s1 = (uint_t)(_arg), \
+            .s2 = (uint_t)pi_thread_exit, \
+            .sp = (uint_t)(_stack) + (_stack_size), \
+        }, \
+        .priority = (_prio), \
+        .not_waiting = 1, \
+    }
+
 extern PI_MEMORY_TINY pi_thread_t *__pi_thread_current;
 extern PI_MEMORY_TINY int __pi_thread_current_running;
 extern PI_MEMORY_TINY uint_t __pi_thread_ready;
@@ -69,6 +114,10 @@ extern PI_MEMORY_TINY pi_thread_t __pi_thread_main;
 
 #endif
 
+// Thread switches deferred while the scheduler is locked
+#define PI_THREAD_SCHED_PENDING_CHECK  (1<<0)
+#define PI_THREAD_SCHED_PENDING_FORCE  (1<<1)
+
 // Offsets for assembly code
 #define PI_THREAD_T_REGS_RA          ( 0*4)
 #define PI_THREAD_T_REGS_S0          ( 1*4)
@@ -95,3 +144,4 @@ extern PI_MEMORY_TINY pi_thread_t __pi_thread_main;
 #define PI_THREAD_T_PRIORITY         (21*4 + 1)
 #define PI_THREAD_T_READY            (21*4 + 2)
 #define PI_THREAD_T_NOT_WAITING      (21*4 + 3)
+#define PI_THREAD_T_TP               (22*4)
@@ -31,6 +31,11 @@ void __pi_thread_switch();
 void __pi_thread_switch_to_next();
 // Thread start stub used to unlock interrupts before executing thread entry point
 void __pi_thread_start();
+#if defined(CONFIG_IRQ_SLEEP_INLINE)
+// Sleep loop of the current thread, executing interrupt handlers without trapping. Returns once
+// the thread is running again.
+void __pi_thread_sleep_inline();
+#endif
 
 extern PI_MEMORY_TINY char __pi_thread_resched;
 
@@ -50,6 +55,47 @@ static inline int __pi_thread_get_highest_prio()
     return __FL1(__pi_thread_ready);
 }
 
+#if defined(CONFIG_THREAD_EDF)
+extern PI_MEMORY_TINY pi_thread_queue_t __pi_thread_ready_queues[PI_THREAD_MAX_PRIORITIES];
+
+// Switch to the first ready thread of the deadline level if its deadline is earlier than the one
+// of the current thread. This is called from the interrupt handler stubs when both are at this
+// level.
+void __pi_thread_edf_resched_check();
+
+// Tell if deadline a is before deadline b. Deadlines are compared through their difference so
+// that the time wrap is handled.
+static inline int __pi_thread_deadline_before(uint_t a, uint_t b)
+{
+    return (int)(a - b) < 0;
+}
+
+// Tell if the first ready thread of the deadline level should preempt the current thread,
+// given the highest ready priority.
+static inline int __pi_thread_edf_preempt(int highest)
+{
+    return highest == CONFIG_THREAD_EDF_PRIORITY &&
+        __pi_thread_current->priority == CONFIG_THREAD_EDF_PRIORITY &&
+        __pi_thread_deadline_before(
+            __pi_thread_ready_queues[CONFIG_THREAD_EDF_PRIORITY].first->deadline,
+            __pi_thread_current->deadline);
+}
+#endif
+
+// Tell if the highest priority ready thread should preempt the current thread. There must be at
+// least one ready thread.
+static inline int __pi_thread_preempt_check()
+{
+    int highest = __pi_thread_get_highest_prio();
+#if defined(CONFIG_THREAD_EDF)
+    if (__pi_thread_edf_preempt(highest))
+    {
+        return 1;
+    }
+#endif
+    return highest > __pi_thread_current->priority;
+}
+
 static inline __attribute__((always_inline)) void __pi_thread_current_unblock(pi_thread_t *thread)
 {
     // In case there is no thread executing, it means we are just in the wfi loop waiting
@@ -57,7 +103,9 @@ static inline __attribute__((always_inline)) void __pi_thread_current_unblock(pi
     // The wfi loop is just looping without checking anything. Since we arrived here from an
     // interrupt handler, we just need to modify the saved PC (MEPC) and return.
     __pi_thread_current_running = 1;
+#if !defined(CONFIG_IRQ_SLEEP_INLINE)
         asm volatile ("csrw %0, %1" :  : "I" (0x341), "r" (__pi_thread_sleep_wakeup) );
+#endif
 }
 
 static inline __attribute__((always_inline)) void __pi_thread_enqueue_ready_check(pi_thread_t *thread)
@@ -110,6 +158,47 @@ ALWAYS_INLINE int pi_thread_status_get(pi_thread_t *thread)
     return thread->status;
 }
 
+#if defined(CONFIG_THREAD_PERIODIC)
+ALWAYS_INLINE int pi_thread_period_overruns_get(pi_thread_t *thread)
+{
+    return thread->overruns;
+}
+
+ALWAYS_INLINE uint32_t *pi_thread_period_jitter_get(pi_thread_t *thread)
+{
+    return thread->jitter;
+}
+#endif
+
+#if defined(CONFIG_THREAD_SCHED_LOCK)
+extern PI_MEMORY_TINY int __pi_thread_sched_locked;
+extern PI_MEMORY_TINY char __pi_thread_sched_pending;
+
+// Do the thread switch which has been deferred while the scheduler was locked
+void __pi_thread_sched_pending_handle();
+
+ALWAYS_INLINE void pi_sched_lock()
+{
+    __pi_thread_sched_locked++;
+    __asm__ __volatile__("" : : : "memory");
+}
+
+ALWAYS_INLINE void pi_sched_unlock()
+{
+    __asm__ __volatile__("" : : : "memory");
+    if (--__pi_thread_sched_locked == 0)
+    {
+        // An interrupt handler may also have flagged a switch while we were reading the flag,
+        // in which case the switch done here will just find nothing to do
+        __asm__ __volatile__("" : : : "memory");
+        if (__pi_thread_sched_pending)
+        {
+            __pi_thread_sched_pending_handle();
+        }
+    }
+}
+#endif
+
 // Get current thread
 static inline pi_thread_t *pi_thread_get_current()
 {
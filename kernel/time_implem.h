@@ -4,16 +4,18 @@
 #include <pmsis/kernel/irq.h>
 #include <pmsis/kernel/event.h>
 
+// The delayed event list is only accessed from priority 0 interrupt routines, and walking it
+// can be long, so higher priority interrupts are kept enabled
 ALWAYS_INLINE void pi_evt_timed_cancel(pi_evt_t *event)
 {
-    int irq = pi_irq_lock();
+    int irq = __pi_irq_kernel_lock();
     pi_evt_timed_cancel_unsafe(event);
-    pi_irq_unlock(irq);
+    __pi_irq_kernel_unlock(irq);
 }
 
 ALWAYS_INLINE void pi_evt_notify_delayed(pi_evt_t *event, uint32_t delay)
 {
-    int irq = pi_irq_lock();
+    int irq = __pi_irq_kernel_lock();
     pi_evt_notify_delayed_unsafe(event, delay);
-    pi_irq_unlock(irq);
+    __pi_irq_kernel_unlock(irq);
 }
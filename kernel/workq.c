@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#include <pmsis/kernel/workq.h>
+#include <pmsis/kernel/time.h>
+#include <pmsis/kernel/irq.h>
+
+// Get and dequeue the highest priority task, or NULL if there is none
+static pi_workq_task_t *__pi_workq_pop(pi_workq_t *workq)
+{
+    if (workq->ready == 0)
+    {
+        return NULL;
+    }
+
+    int priority = __FL1(workq->ready);
+    pi_workq_task_t *task = workq->queues[priority].first;
+    workq->queues[priority].first = (pi_workq_task_t *)task->event.next;
+    // Update the mask so that we do not try to pop from this queue if it is empty
+    if (workq->queues[priority].first == NULL)
+    {
+        workq->ready = __BITCLR_R(workq->ready, 1, priority);
+    }
+    return task;
+}
+
+// Event callback attached to tasks, to push the task to the work-queue when it is notified
+static void __pi_workq_push(pi_evt_t *event)
+{
+    pi_workq_task_t *task = (pi_workq_task_t *)event;
+    pi_workq_t *workq = task->workq;
+    int priority = task->priority;
+
+    // This callback may be executed with interrupts enabled, for example by the kernel thread
+    // executing event callbacks or with nested interrupts, while the queues are also updated by
+    // workers and interrupt handlers
+    int irq = pi_irq_lock();
+
+    task->push_time = (uint32_t)pi_time_get_us();
+
+    if (workq->queues[priority].first)
+    {
+        workq->queues[priority].last->event.next = &task->event;
+    }
+    else
+    {
+        workq->queues[priority].first = task;
+    }
+    workq->queues[priority].last = task;
+    task->event.next = NULL;
+    workq->ready = __BITSET_R(workq->ready, 1, priority);
+
+    // Wake-up one idle worker
+    pi_workq_worker_t *worker = workq->idle;
+    if (worker)
+    {
+        workq->idle = worker->next;
+        pi_evt_notify_unsafe(&worker->event);
+    }
+
+    pi_irq_unlock(irq);
+}
+
+static void __pi_workq_worker_entry(void *arg)
+{
+    pi_workq_worker_t *worker = (pi_workq_worker_t *)arg;
+    pi_workq_t *workq = worker->workq;
+
+    int irq = pi_irq_lock();
+
+    while(1)
+    {
+        pi_workq_task_t *task = __pi_workq_pop(workq);
+
+        if (task == NULL)
+        {
+            // Nothing to do, wait until a task is pushed
+            pi_evt_sig_init(&worker->event);
+            worker->next = workq->idle;
+            workq->idle = worker;
+            pi_evt_sig_wait_unsafe(&worker->event);
+            continue;
+        }
+
+        pi_irq_unlock(irq);
+
+        uint32_t start = (uint32_t)pi_time_get_us();
+        task->latency = start - task->push_time;
+        task->callback(task);
+        task->exec_time = (uint32_t)pi_time_get_us() - start;
+
+        irq = pi_irq_lock();
+    }
+}
+
+int pi_workq_create(pi_workq_t *workq, pi_workq_worker_t *workers, int nb_workers, int priority,
+    void *stacks, unsigned int stack_size)
+{
+    for (int i=0; i<PI_WORKQ_NB_PRIORITIES; i++)
+    {
+        workq->queues[i].first = NULL;
+    }
+    workq->ready = 0;
+    workq->idle = NULL;
+
+    for (int i=0; i<nb_workers; i++)
+    {
+        pi_workq_worker_t *worker = &workers[i];
+        worker->workq = workq;
+
+        if (pi_thread_create(&worker->thread, "workq", __pi_workq_worker_entry, worker, priority,
+            (char *)stacks + i*stack_size, stack_size, NULL))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+pi_evt_t *pi_workq_task_init(pi_workq_task_t *task, pi_workq_t *workq,
+    void (*callback)(pi_workq_task_t *), void *arg, int priority)
+{
+    if (priority < 0 || priority >= PI_WORKQ_NB_PRIORITIES)
+    {
+        return NULL;
+    }
+
+    task->workq = workq;
+    task->callback = callback;
+    task->arg = arg;
+    task->priority = priority;
+    return pi_evt_cb_init(&task->event, __pi_workq_push);
+}
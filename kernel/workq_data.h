@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+#include <stdint.h>
+#include <kernel/event_data.h>
+#include <kernel/thread_data.h>
+
+#define PI_WORKQ_NB_PRIORITIES 4
+
+typedef struct pi_workq_task_s
+{
+    // Event pushing the task when notified. Must be the first field as its callback gets the task
+    // from it. Its next field is used to chain the task in the work-queue.
+    pi_evt_t event;
+    // Work-queue executing the task
+    struct pi_workq_s *workq;
+    // Function executed by the worker
+    void (*callback)(struct pi_workq_task_s *task);
+    // Argument of the function
+    void *arg;
+    // Task priority
+    int priority;
+    // Time in microseconds when the task was pushed
+    uint32_t push_time;
+    // Time in microseconds between the push and the execution start
+    uint32_t latency;
+    // Execution time in microseconds
+    uint32_t exec_time;
+} pi_workq_task_t;
+
+typedef struct pi_workq_worker_s
+{
+    // Worker thread
+    pi_thread_t thread;
+    // Signal event used by the worker to wait for a task
+    pi_evt_t event;
+    // Work-queue of the worker
+    struct pi_workq_s *workq;
+    // Next idle worker
+    struct pi_workq_worker_s *next;
+} pi_workq_worker_t;
+
+typedef struct pi_workq_s
+{
+    // Task queues, one per priority
+    struct
+    {
+        pi_workq_task_t *first;
+        pi_workq_task_t *last;
+    } queues[PI_WORKQ_NB_PRIORITIES];
+    // Mask giving the queues containing at least one task. One bit per queue.
+    uint32_t ready;
+    // Workers waiting for a task
+    pi_workq_worker_t *idle;
+} pi_workq_t;
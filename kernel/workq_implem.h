@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2026 ETH Zurich, University of Bologna and EssilorLuxottica SAS
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Authors: Germain Haugou (germain.haugou@gmail.com)
+
+#pragma once
+
+ALWAYS_INLINE void *pi_workq_task_arg(pi_workq_task_t *task)
+{
+    return task->arg;
+}
+
+ALWAYS_INLINE uint32_t pi_workq_task_latency_get(pi_workq_task_t *task)
+{
+    return task->latency;
+}
+
+ALWAYS_INLINE uint32_t pi_workq_task_exec_time_get(pi_workq_task_t *task)
+{
+    return task->exec_time;
+}
@@ -10,7 +10,11 @@
 
 
 
+#if defined(CONFIG_THREAD_TLS)
+static __thread int errno;
+#else
 static int errno;
+#endif
 int *__errno() { return &errno; }
 
 
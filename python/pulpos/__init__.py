@@ -8,6 +8,7 @@ from __future__ import annotations
 
 import os
 import sys
+import subprocess
 import importlib.util
 import logging
 import collections
@@ -145,6 +146,7 @@ class _LinkCommand(gvrun.commands.Command):
             raise RuntimeError('Trying to compile without any toolchain attached')
 
         self.command = toolchain._get_link_command(flags)
+        self.nm_command = toolchain._get_nm_command(flags.binary)
 
     def run(self):
         """Execute the link command.
@@ -153,6 +155,32 @@ class _LinkCommand(gvrun.commands.Command):
         """
         print (f'LD  {self.flags.binary}', flush=True)
         self.execute(self.command, self.path)
+        self._report_thread_stacks()
+
+    def _report_thread_stacks(self):
+        """Report the memory used by the stacks of the threads declared at build time.
+
+        The linker script groups these stacks between 2 symbols, which are read back from the
+        binary to get the total size.
+        """
+        try:
+            output = subprocess.run(self.nm_command, shell=True, cwd=self.path,
+                capture_output=True, text=True, check=True).stdout
+        except (OSError, subprocess.CalledProcessError) as error:
+            # The report is only informative, the build must not fail because of it
+            logging.debug(f'Could not read symbols to report thread stacks: {error}')
+            return
+
+        symbols = {}
+        for line in output.splitlines():
+            fields = line.split()
+            if len(fields) == 3:
+                symbols[fields[2]] = int(fields[0], 16)
+
+        start = symbols.get('__pi_thread_stacks_start')
+        end = symbols.get('__pi_thread_stacks_end')
+        if start is not None and end is not None and end != start:
+            print (f'    Static thread stacks: {end - start} bytes', flush=True)
 
 
 @dataclasses.dataclass
@@ -56,12 +56,34 @@ class PulpOpenPulposModule(PulposModule):
         self.add_define('CONFIG_ISA_PULPV2', 1)
 
         self.add_define('CONFIG_IRQ_INC', '<arch/pulp/kernel/irq.h>')
+
+        irq_batch = BuildParameter(self, 'irq.batch', False,
+            'Handle all pending interrupts in one IRQ handler entry').value
+        if irq_batch:
+            self.add_define('CONFIG_IRQ_BATCH', 1)
+
+        irq_nested = BuildParameter(self, 'irq.nested', False,
+            'Allow interrupt handlers to be preempted by higher priority interrupts').value
+        if irq_nested:
+            self.add_define('CONFIG_IRQ_NESTED', 1)
+
+        irq_level_lock = BuildParameter(self, 'irq.level_lock', False,
+            'Enable critical sections masking interrupts up to a priority level').value
+        # Nested interrupts are relying on level critical sections for the kernel lock
+        if irq_level_lock or irq_nested:
+            self.add_define('CONFIG_IRQ_LEVEL_LOCK', 1)
+
+        irq_sleep_inline = BuildParameter(self, 'irq.sleep_inline', False,
+            'Execute interrupt handlers without trapping while the core is sleeping').value
+        if irq_sleep_inline:
+            self.add_define('CONFIG_IRQ_SLEEP_INLINE', 1)
         self.add_define('CONFIG_MEMORY_INC', '<arch/pulp/kernel/memory.h>')
 
         self.add_sources([
             'arch/pulp/kernel/hal.c',
             'arch/pulp/kernel/irq.c',
             'arch/pulp/kernel/irq_asm.S',
+            'arch/pulp/kernel/soc_event.c',
         ])
 
         self.add_subdirectory(path, target)
@@ -110,6 +110,13 @@ class Toolchain:
         """
         pass
 
+    @abc.abstractmethod
+    def _get_nm_command(self, binary: str) -> str:
+        """Get the command listing the symbols of a binary.
+        This method must be overriden by the implementation class
+        """
+        pass
+
     def _get_toolchain_command(self, command):
         """Get the full toolchain command.
         """
@@ -226,6 +233,13 @@ class RiscvLlvmToolchain(_LlvmToolchain):
 
         return self._get_link_command_from_ld(ld, flags)
 
+    def _get_nm_command(self, binary: str) -> str:
+        """Get the command listing the symbols of a binary.
+        """
+        nm = self._get_toolchain_command('llvm-nm')
+
+        return f'{nm} {binary}'
+
 
 class RiscvGccToolchain(_GccToolchain):
     """
@@ -256,3 +270,10 @@ class RiscvGccToolchain(_GccToolchain):
         ld = self._get_toolchain_command('riscv32-unknown-elf-gcc')
 
         return self._get_link_command_from_ld(ld, flags)
+
+    def _get_nm_command(self, binary: str) -> str:
+        """Get the command listing the symbols of a binary.
+        """
+        nm = self._get_toolchain_command('riscv32-unknown-elf-nm')
+
+        return f'{nm} {binary}'